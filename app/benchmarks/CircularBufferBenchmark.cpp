@@ -0,0 +1,298 @@
+/*
+ * Serial Studio
+ * https://serial-studio.com/
+ *
+ * Copyright (C) 2020–2025 Alex Spataru
+ *
+ * This file is dual-licensed:
+ *
+ * - Under the GNU GPLv3 (or later) for builds that exclude Pro modules.
+ * - Under the Serial Studio Commercial License for builds that include
+ *   any Pro functionality.
+ *
+ * You must comply with the terms of one of these licenses, depending
+ * on your use case.
+ *
+ * For GPL terms, see <https://www.gnu.org/licenses/gpl-3.0.html>
+ * For commercial terms, see LICENSE_COMMERCIAL.md in the project root.
+ *
+ * SPDX-License-Identifier: GPL-3.0-only OR LicenseRef-SerialStudio-Commercial
+ */
+
+#include <vector>
+#include <QTest>
+#include <QObject>
+#include <QRandomGenerator>
+
+#include "IO/CircularBuffer.h"
+
+using Buffer = IO::CircularBuffer<QByteArray, char>;
+
+//------------------------------------------------------------------------------
+// Reference implementations
+//------------------------------------------------------------------------------
+
+/**
+ * @brief Returns the element stored at logical @a index of a buffer view.
+ */
+static char elementAt(const Buffer::View &view, qsizetype index)
+{
+  if (index < view.firstSize)
+    return view.first[index];
+
+  return view.second[index - view.firstSize];
+}
+
+/**
+ * @brief Brute-force search, used as the ground truth for the equivalence test.
+ */
+static int naiveSearch(const Buffer &buffer, const QByteArray &pattern,
+                       const int pos)
+{
+  const auto view = buffer.view(0, buffer.size());
+  const qsizetype m = pattern.size();
+  for (qsizetype i = pos; i + m <= view.size(); ++i)
+  {
+    qsizetype j = 0;
+    while (j < m && elementAt(view, i + j) == pattern[j])
+      ++j;
+
+    if (j == m)
+      return static_cast<int>(i);
+  }
+
+  return -1;
+}
+
+/**
+ * @brief Element-by-element KMP search, used for every pattern length before
+ *        short patterns were routed through the vectorized scan.
+ */
+static int kmpSearch(const Buffer &buffer, const QByteArray &pattern,
+                     const int pos)
+{
+  // Build the longest prefix suffix table
+  const qsizetype m = pattern.size();
+  std::vector<int> lps(m, 0);
+  for (qsizetype i = 1, len = 0; i < m;)
+  {
+    if (pattern[i] == pattern[len])
+      lps[i++] = static_cast<int>(++len);
+    else if (len != 0)
+      len = lps[len - 1];
+    else
+      lps[i++] = 0;
+  }
+
+  // Scan the buffer
+  const auto view = buffer.view(0, buffer.size());
+  qsizetype i = pos, j = 0;
+  while (i < view.size())
+  {
+    if (elementAt(view, i) == pattern[j])
+    {
+      ++i;
+      if (++j == m)
+        return static_cast<int>(i - m);
+    }
+
+    else if (j != 0)
+      j = lps[j - 1];
+
+    else
+      ++i;
+  }
+
+  return -1;
+}
+
+//------------------------------------------------------------------------------
+// Test & benchmark class
+//------------------------------------------------------------------------------
+
+/**
+ * @brief Validates and measures the circular buffer pattern search.
+ *
+ * Delimiters of one or two bytes are located by scanning the ring segments for
+ * the lead byte (memchr/SSE2/AVX2) instead of running KMP. The equivalence
+ * test compares findPatternKMP() and findPattern() against a brute-force
+ * search on random, wrapped buffers, while the benchmarks compare the current
+ * search against plain KMP for several pattern lengths and fill levels.
+ */
+class CircularBufferBenchmark : public QObject
+{
+  Q_OBJECT
+
+private slots:
+  void randomizedEquivalence();
+
+  void kmpSearch_data();
+  void kmpSearch();
+  void bufferSearch_data();
+  void bufferSearch();
+
+private:
+  void addSearchRows();
+  void fillBuffer(Buffer &buffer, qsizetype fill, const QByteArray &pattern);
+};
+
+/**
+ * @brief Compares both buffer searches against a brute-force search.
+ *
+ * Uses a small alphabet so that partial and overlapping matches are frequent,
+ * and random append/consume cycles so that the data wraps around the ring.
+ */
+void CircularBufferBenchmark::randomizedEquivalence()
+{
+  QRandomGenerator rng(0x5e71a1);
+  static const QByteArray alphabet = QByteArrayLiteral("ab\r\n");
+
+  for (int round = 0; round < 2000; ++round)
+  {
+    // Fill a small ring with random data, wrapping around its end
+    Buffer buffer(rng.bounded(8, 96));
+    const int cycles = rng.bounded(1, 6);
+    for (int c = 0; c < cycles; ++c)
+    {
+      QByteArray chunk(rng.bounded(1, 64), Qt::Uninitialized);
+      for (auto &byte : chunk)
+        byte = alphabet[rng.bounded(alphabet.size())];
+
+      buffer.append(chunk);
+      if (buffer.size() > 0)
+        buffer.consume(rng.bounded(buffer.size() + 1));
+    }
+
+    // Search for random patterns from random positions
+    for (int p = 0; p < 8; ++p)
+    {
+      QByteArray pattern(rng.bounded(1, 6), Qt::Uninitialized);
+      for (auto &byte : pattern)
+        byte = alphabet[rng.bounded(alphabet.size())];
+
+      const int size = static_cast<int>(buffer.size());
+      const int pos = size > 0 ? rng.bounded(size + 1) : 0;
+      const int expected = naiveSearch(buffer, pattern, pos);
+
+      Buffer::Searcher searcher(pattern);
+      QCOMPARE(buffer.findPattern(searcher, pos), expected);
+      QCOMPARE(buffer.findPatternKMP(pattern, pos), expected);
+      QCOMPARE(kmpSearch(buffer, pattern, pos), expected);
+    }
+  }
+}
+
+/**
+ * @brief Registers the rows of the plain KMP benchmark.
+ */
+void CircularBufferBenchmark::kmpSearch_data()
+{
+  addSearchRows();
+}
+
+/**
+ * @brief Locates the delimiter at the end of the buffer with plain KMP.
+ */
+void CircularBufferBenchmark::kmpSearch()
+{
+  QFETCH(qsizetype, fill);
+  QFETCH(QByteArray, pattern);
+
+  Buffer buffer(fill + fill / 2);
+  fillBuffer(buffer, fill, pattern);
+
+  int index = -1;
+  QBENCHMARK
+  {
+    index = ::kmpSearch(buffer, pattern, 0);
+  }
+
+  QCOMPARE(index, static_cast<int>(buffer.size() - pattern.size()));
+}
+
+/**
+ * @brief Registers the rows of the buffer search benchmark.
+ */
+void CircularBufferBenchmark::bufferSearch_data()
+{
+  addSearchRows();
+}
+
+/**
+ * @brief Locates the delimiter at the end of the buffer with findPatternKMP().
+ */
+void CircularBufferBenchmark::bufferSearch()
+{
+  QFETCH(qsizetype, fill);
+  QFETCH(QByteArray, pattern);
+
+  Buffer buffer(fill + fill / 2);
+  fillBuffer(buffer, fill, pattern);
+
+  int index = -1;
+  QBENCHMARK
+  {
+    index = buffer.findPatternKMP(pattern, 0);
+  }
+
+  QCOMPARE(index, static_cast<int>(buffer.size() - pattern.size()));
+}
+
+/**
+ * @brief Adds one row per pattern length (1, 2, 4 & 8 bytes) and fill level
+ *        (1 KiB, 64 KiB, 1 MiB & 8 MiB).
+ */
+void CircularBufferBenchmark::addSearchRows()
+{
+  QTest::addColumn<qsizetype>("fill");
+  QTest::addColumn<QByteArray>("pattern");
+
+  static const QByteArray patterns[]
+      = {QByteArrayLiteral("\n"), QByteArrayLiteral("\r\n"),
+         QByteArrayLiteral("*END"), QByteArrayLiteral("*FRAME*\n")};
+  static const qsizetype fills[]
+      = {1024, 64 * 1024, 1024 * 1024, 8 * 1024 * 1024};
+
+  for (const auto &pattern : patterns)
+  {
+    for (const auto fill : fills)
+    {
+      const auto name = QStringLiteral("%1 B pattern, %2 KiB")
+                            .arg(pattern.size())
+                            .arg(fill / 1024);
+      QTest::newRow(qPrintable(name)) << fill << pattern;
+    }
+  }
+}
+
+/**
+ * @brief Fills @a buffer with @a fill bytes that end with @a pattern.
+ *
+ * The payload consists of comma separated digits, so that the delimiter only
+ * occurs at the very end. The buffer is expected to hold 1.5 times @a fill
+ * bytes; @a fill bytes are written and consumed first, which makes the data
+ * wrap around the end of the ring halfway through.
+ */
+void CircularBufferBenchmark::fillBuffer(Buffer &buffer, qsizetype fill,
+                                         const QByteArray &pattern)
+{
+  // Move the head to the middle of the ring
+  buffer.append(QByteArray(fill, '0'));
+  buffer.consume(fill);
+
+  // Generate the payload
+  QRandomGenerator rng(fill);
+  QByteArray data(fill - pattern.size(), Qt::Uninitialized);
+  for (auto &byte : data)
+  {
+    const int digit = rng.bounded(11);
+    byte = digit == 10 ? ',' : static_cast<char>('0' + digit);
+  }
+
+  // Append the payload followed by the delimiter
+  data.append(pattern);
+  buffer.append(data);
+}
+
+QTEST_MAIN(CircularBufferBenchmark)
+#include "CircularBufferBenchmark.moc"
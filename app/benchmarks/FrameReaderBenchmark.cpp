@@ -0,0 +1,111 @@
+/*
+ * Serial Studio
+ * https://serial-studio.com/
+ *
+ * Copyright (C) 2020–2025 Alex Spataru
+ *
+ * This file is dual-licensed:
+ *
+ * - Under the GNU GPLv3 (or later) for builds that exclude Pro modules.
+ * - Under the Serial Studio Commercial License for builds that include
+ *   any Pro functionality.
+ *
+ * You must comply with the terms of one of these licenses, depending
+ * on your use case.
+ *
+ * For GPL terms, see <https://www.gnu.org/licenses/gpl-3.0.html>
+ * For commercial terms, see LICENSE_COMMERCIAL.md in the project root.
+ *
+ * SPDX-License-Identifier: GPL-3.0-only OR LicenseRef-SerialStudio-Commercial
+ */
+
+#include <QTest>
+#include <QObject>
+
+#include "IO/Checksum.h"
+#include "IO/FrameReader.h"
+
+/**
+ * Number of frames that are fed to the frame reader at once.
+ */
+static constexpr qsizetype FRAME_COUNT = 100000;
+
+/**
+ * @brief Measures frame extraction with checksum validation when the frame
+ *        reader receives a large backlog of frames at once.
+ *
+ * Checksum validation used to copy the whole circular buffer for every frame,
+ * so the cost per frame grew with the amount of data waiting in the buffer.
+ * This benchmark feeds FRAME_COUNT checksummed frames in a single chunk and
+ * verifies that every frame passes validation.
+ */
+class FrameReaderBenchmark : public QObject
+{
+  Q_OBJECT
+
+private slots:
+  void checksummedBacklog_data();
+  void checksummedBacklog();
+};
+
+/**
+ * @brief Registers one benchmark row per checksum length.
+ */
+void FrameReaderBenchmark::checksummedBacklog_data()
+{
+  QTest::addColumn<QString>("algorithm");
+  QTest::newRow("CRC-8") << QStringLiteral("CRC-8");
+  QTest::newRow("CRC-16") << QStringLiteral("CRC-16");
+  QTest::newRow("CRC-32") << QStringLiteral("CRC-32");
+}
+
+/**
+ * @brief Extracts FRAME_COUNT frames with the form "$a,b,c;<checksum>".
+ */
+void FrameReaderBenchmark::checksummedBacklog()
+{
+  QFETCH(QString, algorithm);
+  QVERIFY(IO::availableChecksums().contains(algorithm));
+
+  // Generate the backlog
+  QByteArray stream;
+  stream.reserve(FRAME_COUNT * 32);
+  for (qsizetype i = 0; i < FRAME_COUNT; ++i)
+  {
+    QByteArray payload;
+    payload.append(QByteArray::number(i));
+    payload.append(',');
+    payload.append(QByteArray::number(i * 2));
+    payload.append(',');
+    payload.append(QByteArray::number(i % 1000));
+
+    stream.append('$');
+    stream.append(payload);
+    stream.append(';');
+    stream.append(IO::checksum(algorithm, payload));
+  }
+
+  // Extract & validate every frame
+  QBENCHMARK
+  {
+    IO::FrameReader reader;
+    reader.setQueuePolicy(IO::QueuePolicy::Grow);
+    reader.setOperationMode(SerialStudio::ProjectFile);
+    reader.setFrameDetectionMode(SerialStudio::StartAndEndDelimiter);
+    reader.setStartSequence(QByteArrayLiteral("$"));
+    reader.setFinishSequence(QByteArrayLiteral(";"));
+    reader.setChecksum(algorithm);
+    reader.processData(stream);
+
+    qsizetype frames = 0;
+    QByteArray frame;
+    while (reader.dequeueFrame(frame))
+      ++frames;
+
+    QCOMPARE(frames, FRAME_COUNT);
+    QCOMPARE(reader.framesDropped(), quint64(0));
+  }
+}
+
+QTEST_MAIN(FrameReaderBenchmark)
+#include "FrameReaderBenchmark.moc"
@@ -0,0 +1,251 @@
+/*
+ * Serial Studio
+ * https://serial-studio.com/
+ *
+ * Copyright (C) 2020–2025 Alex Spataru
+ *
+ * This file is dual-licensed:
+ *
+ * - Under the GNU GPLv3 (or later) for builds that exclude Pro modules.
+ * - Under the Serial Studio Commercial License for builds that include
+ *   any Pro functionality.
+ *
+ * You must comply with the terms of one of these licenses, depending
+ * on your use case.
+ *
+ * For GPL terms, see <https://www.gnu.org/licenses/gpl-3.0.html>
+ * For commercial terms, see LICENSE_COMMERCIAL.md in the project root.
+ *
+ * SPDX-License-Identifier: GPL-3.0-only OR LicenseRef-SerialStudio-Commercial
+ */
+
+#include <QTest>
+#include <QObject>
+#include <QRandomGenerator>
+
+#include "JSON/Frame.h"
+#include "JSON/FrameBuilder.h"
+#include "JSON/FramePipeline.h"
+
+/**
+ * Number of Quick Plot lines processed by each benchmark iteration.
+ */
+static constexpr int FRAME_BATCH = 1000;
+
+/**
+ * Number of distinct lines that are cycled through by the benchmarks.
+ */
+static constexpr int DISTINCT_LINES = 64;
+
+//------------------------------------------------------------------------------
+// Reference implementation
+//------------------------------------------------------------------------------
+
+/**
+ * @brief Quick Plot tokenizer used before lines were split on UTF-8 bytes.
+ *
+ * Converts the line to UTF-16, splits it into trimmed string views and creates
+ * a string for every dataset. The values are written into @a datasets, which
+ * holds a copy of every dataset of the frame in group order.
+ */
+static void legacyUpdate(QVector<JSON::Dataset> &datasets, int channelCount,
+                         const QByteArray &data)
+{
+  // Create a vector of channels
+  QVector<QStringView> channels;
+  if (channelCount > 0) [[likely]]
+    channels.reserve(channelCount);
+  else
+    channels.reserve(64);
+
+  // Split the string into commas
+  int start = 0;
+  const auto str = QString::fromUtf8(data);
+  QStringView view(str);
+  const int dataLength = view.size();
+  for (int i = 0; i <= dataLength; ++i)
+  {
+    if (i == dataLength || view[i] == ',')
+    {
+      channels.append(view.mid(start, i - start).trimmed());
+      start = i + 1;
+    }
+  }
+
+  // Update the values of the quick plot datasets
+  const int count = channels.count();
+  for (auto &dataset : datasets)
+  {
+    const int index = dataset.index();
+    if (index > 0 && index <= count) [[likely]]
+    {
+      double number;
+      const auto &channel = channels[index - 1];
+      const bool numeric = JSON::Dataset::parseNumber(channel, number);
+      dataset.setValue(channel.toString(), number, numeric);
+    }
+  }
+}
+
+//------------------------------------------------------------------------------
+// Benchmark class
+//------------------------------------------------------------------------------
+
+/**
+ * @brief Measures Quick Plot line parsing at 8, 64 and 512 channels.
+ *
+ * Compares the UTF-16 based tokenizer that was used before (legacyTokenizer)
+ * with FrameBuilder::updateQuickPlotFrame() (byteTokenizer), which splits the
+ * UTF-8 bytes with memchr() and writes the values into the existing strings
+ * of the datasets.
+ *
+ * Every iteration processes FRAME_BATCH lines, the throughput in frames per
+ * second is therefore FRAME_BATCH * 1000 divided by the reported msecs.
+ */
+class QuickPlotBenchmark : public QObject
+{
+  Q_OBJECT
+
+private slots:
+  void legacyTokenizer_data();
+  void legacyTokenizer();
+  void byteTokenizer_data();
+  void byteTokenizer();
+
+private:
+  void addChannelRows();
+  QList<QByteArray> generateLines(int channels);
+};
+
+/**
+ * @brief Registers the rows of the legacy tokenizer benchmark.
+ */
+void QuickPlotBenchmark::legacyTokenizer_data()
+{
+  addChannelRows();
+}
+
+/**
+ * @brief Parses FRAME_BATCH lines with the UTF-16 based tokenizer.
+ */
+void QuickPlotBenchmark::legacyTokenizer()
+{
+  QFETCH(int, channels);
+  const auto lines = generateLines(channels);
+
+  // Build the frame layout & copy its datasets
+  JSON::Frame frame;
+  int channelCount = -1;
+  JSON::FrameBuilder::updateQuickPlotFrame(frame, channelCount, {}, lines[0]);
+  QCOMPARE(channelCount, channels);
+
+  QVector<JSON::Dataset> datasets;
+  for (const auto &group : frame.groups())
+    datasets.append(group.datasets());
+
+  // Parse the lines
+  QBENCHMARK
+  {
+    for (int i = 0; i < FRAME_BATCH; ++i)
+      legacyUpdate(datasets, channelCount, lines[i % DISTINCT_LINES]);
+  }
+
+  QVERIFY(datasets.first().isNumeric());
+}
+
+/**
+ * @brief Registers the rows of the byte tokenizer benchmark.
+ */
+void QuickPlotBenchmark::byteTokenizer_data()
+{
+  addChannelRows();
+}
+
+/**
+ * @brief Parses FRAME_BATCH lines with FrameBuilder::updateQuickPlotFrame().
+ */
+void QuickPlotBenchmark::byteTokenizer()
+{
+  QFETCH(int, channels);
+  const auto lines = generateLines(channels);
+
+  // Build the frame layout
+  JSON::Frame frame;
+  int channelCount = -1;
+  JSON::FrameBuilder::updateQuickPlotFrame(frame, channelCount, {}, lines[0]);
+  QCOMPARE(channelCount, channels);
+
+  // Parse the lines
+  QBENCHMARK
+  {
+    for (int i = 0; i < FRAME_BATCH; ++i)
+    {
+      JSON::FrameBuilder::updateQuickPlotFrame(frame, channelCount, {},
+                                               lines[i % DISTINCT_LINES]);
+    }
+  }
+
+  // Both tokenizers must produce the same values
+  QVector<JSON::Dataset> datasets;
+  for (const auto &group : frame.groups())
+    datasets.append(group.datasets());
+
+  const auto &line = lines[(FRAME_BATCH - 1) % DISTINCT_LINES];
+  auto expected = datasets;
+  legacyUpdate(expected, channelCount, line);
+  JSON::FrameBuilder::updateQuickPlotFrame(frame, channelCount, {}, line);
+
+  qsizetype index = 0;
+  QCOMPARE(channelCount, channels);
+  for (const auto &group : frame.groups())
+  {
+    for (const auto &dataset : group.datasets())
+    {
+      QCOMPARE(dataset.value(), expected[index].value());
+      QCOMPARE(dataset.isNumeric(), expected[index].isNumeric());
+      QCOMPARE(dataset.numericValue(), expected[index].numericValue());
+      ++index;
+    }
+  }
+}
+
+/**
+ * @brief Adds one row per channel count.
+ */
+void QuickPlotBenchmark::addChannelRows()
+{
+  QTest::addColumn<int>("channels");
+  QTest::newRow("8 channels") << 8;
+  QTest::newRow("64 channels") << 64;
+  QTest::newRow("512 channels") << 512;
+}
+
+/**
+ * @brief Generates DISTINCT_LINES comma separated lines with @a channels
+ *        values, padded with whitespace like typical serial output.
+ */
+QList<QByteArray> QuickPlotBenchmark::generateLines(int channels)
+{
+  QList<QByteArray> lines;
+  QRandomGenerator rng(static_cast<quint32>(channels));
+  for (int l = 0; l < DISTINCT_LINES; ++l)
+  {
+    QByteArray line;
+    for (int c = 0; c < channels; ++c)
+    {
+      if (c > 0)
+        line.append(", ");
+
+      const double value = rng.bounded(2000.0) - 1000.0;
+      line.append(QByteArray::number(value, 'f', 3));
+    }
+
+    line.append("\r\n");
+    lines.append(line);
+  }
+
+  return lines;
+}
+
+QTEST_MAIN(QuickPlotBenchmark)
+#include "QuickPlotBenchmark.moc"
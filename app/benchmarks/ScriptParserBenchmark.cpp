@@ -0,0 +1,200 @@
+/*
+ * Serial Studio
+ * https://serial-studio.com/
+ *
+ * Copyright (C) 2020–2025 Alex Spataru
+ *
+ * This file is dual-licensed:
+ *
+ * - Under the GNU GPLv3 (or later) for builds that exclude Pro modules.
+ * - Under the Serial Studio Commercial License for builds that include
+ *   any Pro functionality.
+ *
+ * You must comply with the terms of one of these licenses, depending
+ * on your use case.
+ *
+ * For GPL terms, see <https://www.gnu.org/licenses/gpl-3.0.html>
+ * For commercial terms, see LICENSE_COMMERCIAL.md in the project root.
+ *
+ * SPDX-License-Identifier: GPL-3.0-only OR LicenseRef-SerialStudio-Commercial
+ */
+
+#include <QTest>
+#include <QObject>
+#include <QJSEngine>
+#include <QRandomGenerator>
+
+#include "JSON/ScriptParser.h"
+
+/**
+ * Number of frames passed to the parser by each benchmark iteration.
+ */
+static constexpr int FRAME_BATCH = 1000;
+
+/**
+ * Binary frame parser that reads a few header bytes and the frame length,
+ * like typical binary protocols do, so that the cost of handing the frame
+ * to JavaScript dominates the measurement.
+ */
+static const QString PARSER_CODE = QStringLiteral(R"(
+function parse(frame) {
+  return [frame[0], frame[1], frame[frame.length - 1], frame.length];
+}
+)");
+
+/**
+ * @brief Measures how binary frames are passed to the JavaScript frame parser.
+ *
+ * Binary frames used to be copied into a JavaScript array with one
+ * setProperty() call per byte (setPropertyBridge). They are now wrapped in a
+ * @c Uint8Array created from an @c ArrayBuffer (uint8ArrayBridge), which
+ * costs the same for any frame size. scriptParser runs the complete
+ * JSON::ScriptParser path, including reading the returned channels.
+ */
+class ScriptParserBenchmark : public QObject
+{
+  Q_OBJECT
+
+private slots:
+  void setPropertyBridge_data();
+  void setPropertyBridge();
+  void uint8ArrayBridge_data();
+  void uint8ArrayBridge();
+  void scriptParser_data();
+  void scriptParser();
+
+private:
+  void addFrameRows();
+  QByteArray generateFrame(int size);
+};
+
+/**
+ * @brief Registers the rows of the per-byte bridge benchmark.
+ */
+void ScriptParserBenchmark::setPropertyBridge_data()
+{
+  addFrameRows();
+}
+
+/**
+ * @brief Builds a JavaScript array with setProperty() for every frame.
+ */
+void ScriptParserBenchmark::setPropertyBridge()
+{
+  QFETCH(int, size);
+  const auto frame = generateFrame(size);
+
+  QJSEngine engine;
+  engine.evaluate(PARSER_CODE);
+  auto parse = engine.globalObject().property("parse");
+  QVERIFY(parse.isCallable());
+
+  QJSValue result;
+  QBENCHMARK
+  {
+    for (int i = 0; i < FRAME_BATCH; ++i)
+    {
+      QJSValue jsArray = engine.newArray(frame.size());
+      const auto *data = reinterpret_cast<const quint8 *>(frame.constData());
+      for (int j = 0; j < frame.size(); ++j)
+        jsArray.setProperty(j, data[j]);
+
+      result = parse.call({jsArray});
+    }
+  }
+
+  QCOMPARE(result.property(3).toInt(), size);
+}
+
+/**
+ * @brief Registers the rows of the typed array bridge benchmark.
+ */
+void ScriptParserBenchmark::uint8ArrayBridge_data()
+{
+  addFrameRows();
+}
+
+/**
+ * @brief Wraps every frame in a @c Uint8Array backed by an @c ArrayBuffer.
+ */
+void ScriptParserBenchmark::uint8ArrayBridge()
+{
+  QFETCH(int, size);
+  const auto frame = generateFrame(size);
+
+  QJSEngine engine;
+  engine.evaluate(PARSER_CODE);
+  auto parse = engine.globalObject().property("parse");
+  auto uint8Array = engine.globalObject().property("Uint8Array");
+  QVERIFY(parse.isCallable());
+  QVERIFY(uint8Array.isCallable());
+
+  QJSValue result;
+  QBENCHMARK
+  {
+    for (int i = 0; i < FRAME_BATCH; ++i)
+    {
+      const auto buffer = engine.toScriptValue(frame);
+      result = parse.call({uint8Array.callAsConstructor({buffer})});
+    }
+  }
+
+  QCOMPARE(result.property(0).toInt(), int(static_cast<quint8>(frame[0])));
+  QCOMPARE(result.property(3).toInt(), size);
+}
+
+/**
+ * @brief Registers the rows of the script parser benchmark.
+ */
+void ScriptParserBenchmark::scriptParser_data()
+{
+  addFrameRows();
+}
+
+/**
+ * @brief Parses every frame with JSON::ScriptParser using binary decoding.
+ */
+void ScriptParserBenchmark::scriptParser()
+{
+  QFETCH(int, size);
+  const auto frame = generateFrame(size);
+
+  JSON::ScriptParser parser;
+  QVERIFY(parser.load(PARSER_CODE, SerialStudio::Binary, true));
+
+  QVector<JSON::DatasetValue> channels;
+  QBENCHMARK
+  {
+    for (int i = 0; i < FRAME_BATCH; ++i)
+      channels = parser.parse(frame);
+  }
+
+  QCOMPARE(channels.count(), 4);
+  QCOMPARE(channels[3].numericValue, double(size));
+}
+
+/**
+ * @brief Adds one row per frame size (256 bytes & 4 KB).
+ */
+void ScriptParserBenchmark::addFrameRows()
+{
+  QTest::addColumn<int>("size");
+  QTest::newRow("256 B") << 256;
+  QTest::newRow("4 KB") << 4096;
+}
+
+/**
+ * @brief Generates a frame of @a size random bytes.
+ */
+QByteArray ScriptParserBenchmark::generateFrame(int size)
+{
+  QByteArray frame(size, Qt::Uninitialized);
+  QRandomGenerator rng(static_cast<quint32>(size));
+  for (auto &byte : frame)
+    byte = static_cast<char>(rng.bounded(256));
+
+  return frame;
+}
+
+QTEST_MAIN(ScriptParserBenchmark)
+#include "ScriptParserBenchmark.moc"
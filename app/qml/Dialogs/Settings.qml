@@ -49,6 +49,7 @@ Window {
     category: "Preferences"
     property alias plugins: _tcpPlugins.checked
     property alias dashboardPoints: _points.value
+    property alias dashboardDecimation: _decimation.currentIndex
     property alias dashboardPrecision: _decimalDigits.value
     property alias dashboardActionPanel: _actionsPanel.checked
   }
@@ -329,6 +330,23 @@ Window {
             }
           }
 
+          //
+          // Plot decimation
+          //
+          Label {
+            text: qsTr("Plot Decimation")
+            color: Cpp_ThemeManager.colors["text"]
+          } ComboBox {
+            id: _decimation
+            Layout.fillWidth: true
+            currentIndex: Cpp_UI_Dashboard.plotDecimation
+            model: Cpp_UI_Dashboard.availablePlotDecimations
+            onCurrentIndexChanged: {
+              if (currentIndex !== Cpp_UI_Dashboard.plotDecimation)
+                Cpp_UI_Dashboard.plotDecimation = currentIndex
+            }
+          }
+
           //
           // Decimal digits
           //
@@ -405,6 +423,85 @@ Window {
                 Cpp_IO_Manager.threadedFrameExtraction = checked
             }
           }
+
+          //
+          // Frame parsing
+          //
+          Label {
+            opacity: enabled ? 1 : 0.5
+            enabled: !Cpp_IO_Manager.isConnected
+            color: Cpp_ThemeManager.colors["text"]
+            text: qsTr("Use Separate Thread for Frame Parsing")
+          } Switch {
+            Layout.rightMargin: -8
+            opacity: enabled ? 1 : 0.5
+            Layout.alignment: Qt.AlignRight
+            enabled: !Cpp_IO_Manager.isConnected
+            checked: Cpp_JSON_FrameBuilder.threadedFrameParsing
+            palette.highlight: Cpp_ThemeManager.colors["switch_highlight"]
+            onCheckedChanged: {
+              if (checked !== Cpp_JSON_FrameBuilder.threadedFrameParsing)
+                Cpp_JSON_FrameBuilder.threadedFrameParsing = checked
+            }
+          }
+
+          //
+          // Maximum number of stateless frame parser threads
+          //
+          Label {
+            opacity: enabled ? 1 : 0.5
+            color: Cpp_ThemeManager.colors["text"]
+            text: qsTr("Max. Stateless Frame Parser Threads")
+            enabled: !Cpp_IO_Manager.isConnected
+                     && Cpp_JSON_FrameBuilder.threadedFrameParsing
+          } SpinBox {
+            from: 1
+            editable: true
+            Layout.fillWidth: true
+            opacity: enabled ? 1 : 0.5
+            to: Cpp_JSON_FrameBuilder.maxParserThreads
+            value: Cpp_JSON_FrameBuilder.parserThreads
+            enabled: !Cpp_IO_Manager.isConnected
+                     && Cpp_JSON_FrameBuilder.threadedFrameParsing
+            onValueChanged: {
+              if (value !== Cpp_JSON_FrameBuilder.parserThreads)
+                Cpp_JSON_FrameBuilder.parserThreads = value
+            }
+          }
+
+          //
+          // Frame queue backpressure policy
+          //
+          Label {
+            color: Cpp_ThemeManager.colors["text"]
+            text: qsTr("When Frame Queue is Full")
+          } ComboBox {
+            Layout.fillWidth: true
+            currentIndex: Cpp_IO_Manager.queuePolicy
+            model: Cpp_IO_Manager.availableQueuePolicies
+            onCurrentIndexChanged: {
+              if (currentIndex !== Cpp_IO_Manager.queuePolicy)
+                Cpp_IO_Manager.queuePolicy = currentIndex
+            }
+          }
+
+          //
+          // Frame batching latency
+          //
+          Label {
+            color: Cpp_ThemeManager.colors["text"]
+            text: qsTr("Max. Frame Batching Latency (ms)")
+          } SpinBox {
+            to: 1000
+            from: 0
+            editable: true
+            Layout.fillWidth: true
+            value: Cpp_IO_Manager.frameBatchLatency
+            onValueChanged: {
+              if (value !== Cpp_IO_Manager.frameBatchLatency)
+                Cpp_IO_Manager.frameBatchLatency = value
+            }
+          }
         }
       }
 
@@ -440,11 +537,16 @@ Window {
           onClicked: {
             Cpp_ThemeManager.theme = 0
             Cpp_UI_Dashboard.points = 100
+            Cpp_UI_Dashboard.plotDecimation = Cpp_UI_Dashboard.defaultPlotDecimation
             Cpp_UI_Dashboard.precision = 2
             Cpp_Plugins_Bridge.enabled = false
             mainWindow.automaticUpdates  = true
             Cpp_UI_Dashboard.terminalEnabled = false
+            Cpp_IO_Manager.queuePolicy = Cpp_IO_Manager.defaultQueuePolicy
+            Cpp_IO_Manager.frameBatchLatency = 0
             Cpp_IO_Manager.threadedFrameExtraction = false
+            Cpp_JSON_FrameBuilder.threadedFrameParsing = false
+            Cpp_JSON_FrameBuilder.parserThreads = Cpp_JSON_FrameBuilder.maxParserThreads
             Cpp_Misc_ModuleManager.softwareRendering = false
           }
         }
@@ -386,6 +386,90 @@ Widgets.Pane {
                      }
         }
       }
+
+      //
+      // Parser profiler statistics
+      //
+      Rectangle {
+        z: 2
+        Layout.fillWidth: true
+        Layout.maximumHeight: Layout.minimumHeight
+        Layout.minimumHeight: profiler.implicitHeight + 12
+        color: Cpp_ThemeManager.colors["window_toolbar_background"]
+
+        //
+        // Top border
+        //
+        Rectangle {
+          height: 1
+          anchors.top: parent.top
+          anchors.left: parent.left
+          anchors.right: parent.right
+          color: Cpp_ThemeManager.colors["groupbox_border"]
+        }
+
+        RowLayout {
+          id: profiler
+          spacing: 12
+
+          anchors {
+            margins: 8
+            left: parent.left
+            right: parent.right
+            verticalCenter: parent.verticalCenter
+          }
+
+          Label {
+            font: Cpp_Misc_CommonFonts.monoFont
+            color: Cpp_ThemeManager.colors["text"]
+            text: qsTr("Calls/s: %1").arg(Cpp_JSON_ParserProfiler.callsPerSecond.toFixed(0))
+          }
+
+          Label {
+            font: Cpp_Misc_CommonFonts.monoFont
+            color: Cpp_ThemeManager.colors["text"]
+            text: qsTr("p50: %1 µs").arg(Cpp_JSON_ParserProfiler.p50Latency.toFixed(1))
+          }
+
+          Label {
+            font: Cpp_Misc_CommonFonts.monoFont
+            color: Cpp_ThemeManager.colors["text"]
+            text: qsTr("p99: %1 µs").arg(Cpp_JSON_ParserProfiler.p99Latency.toFixed(1))
+          }
+
+          Label {
+            font: Cpp_Misc_CommonFonts.monoFont
+            color: Cpp_ThemeManager.colors["text"]
+            text: qsTr("Max: %1 µs").arg(Cpp_JSON_ParserProfiler.maxLatency.toFixed(1))
+          }
+
+          Label {
+            font: Cpp_Misc_CommonFonts.monoFont
+            color: Cpp_ThemeManager.colors["text"]
+            text: qsTr("GC: %1 ms").arg(Cpp_JSON_ParserProfiler.gcPause.toFixed(2))
+          }
+
+          Label {
+            font: Cpp_Misc_CommonFonts.monoFont
+            color: Cpp_ThemeManager.colors["text"]
+            text: qsTr("Budget: %1%").arg(Cpp_JSON_ParserProfiler.budgetUsage.toFixed(1))
+          }
+
+          Item {
+            Layout.fillWidth: true
+          }
+
+          Button {
+            text: qsTr("Reset")
+            onClicked: Cpp_JSON_ParserProfiler.reset()
+          }
+
+          Button {
+            text: qsTr("Export")
+            onClicked: Cpp_JSON_ParserProfiler.exportReport()
+          }
+        }
+      }
     }
   }
 }
@@ -223,6 +223,26 @@ Item {
     Item {
       Layout.fillWidth: true
     }
+
+    Label {
+      visible: root.model.decimationRatio > 1
+      font: Cpp_Misc_CommonFonts.customMonoFont(0.83)
+      color: Cpp_ThemeManager.colors["widget_text"]
+      text: qsTr("%1:1").arg(root.model.decimationRatio.toFixed(1))
+    }
+
+    Item {
+      implicitWidth: 8
+    }
+  }
+
+  //
+  // Decimate plot data to the available width
+  //
+  Binding {
+    target: root.model
+    property: "pixelWidth"
+    value: Math.round(plot.width * plot.xAxis.zoom)
   }
 
   //
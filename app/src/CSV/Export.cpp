@@ -29,6 +29,7 @@
 #include "MQTT/Client.h"
 
 #include <QDir>
+#include <QHash>
 #include <QDateTime>
 
 //------------------------------------------------------------------------------
@@ -144,7 +145,9 @@ void CSV::Export::closeFile()
 
   // Close the file & reset the status
   m_csvFile.close();
+  m_columnValues.clear();
   m_indexHeaderPairs.clear();
+  m_columnStructure.reset();
   m_textStream.setDevice(nullptr);
 
   // Update UI
@@ -190,17 +193,18 @@ void CSV::Export::setExportEnabled(const bool enabled)
 //------------------------------------------------------------------------------
 
 /**
- * @brief Registers a new data frame for export.
+ * @brief Registers a new frame record for export.
  *
- * Pushes the frame into the pending queue for async export if conditions are
- * met.
+ * Pushes the record into the pending queue for async export if conditions are
+ * met. Records only hold the dataset values and a shared reference to the
+ * frame structure, so no frame is copied here.
  *
- * @param frame The data frame to export.
+ * @param record The frame record to export.
  */
-void CSV::Export::hotpathTxFrame(const JSON::Frame &frame)
+void CSV::Export::hotpathTxFrame(const JSON::FrameRecord &record)
 {
   // Skip if export is disabled, frame is invalid or user is playing a CSV file
-  if (!exportEnabled() || !frame.isValid() || CSV::Player::instance().isOpen())
+  if (!exportEnabled() || !record.isValid() || CSV::Player::instance().isOpen())
     return;
 
   // Skip if not connected to a device
@@ -209,8 +213,8 @@ void CSV::Export::hotpathTxFrame(const JSON::Frame &frame)
            && MQTT::Client::instance().isSubscriber()))
     return;
 
-  // Add frame to pending frame queue
-  if (!m_pendingFrames.enqueue(TimestampFrame(JSON::Frame(frame))))
+  // Add record to pending frame queue
+  if (!m_pendingFrames.enqueue(record))
     qWarning() << "CSV Export: Dropping frame (queue full)";
 }
 
@@ -234,9 +238,9 @@ void CSV::Export::writeValues()
   m_writeBuffer.clear();
 
   // Read frames in queue
-  TimestampFrame frame;
-  while (m_pendingFrames.try_dequeue(frame))
-    m_writeBuffer.push_back(std::move(frame));
+  JSON::FrameRecord record;
+  while (m_pendingFrames.try_dequeue(record))
+    m_writeBuffer.push_back(std::move(record));
 
   // Nothing to write, abort
   if (m_writeBuffer.size() <= 0)
@@ -245,7 +249,8 @@ void CSV::Export::writeValues()
   // File deleted, create new file
   if (!isOpen())
   {
-    m_indexHeaderPairs = createCsvFile(m_writeBuffer.begin()->data);
+    m_columnStructure.reset();
+    m_indexHeaderPairs = createCsvFile(*m_writeBuffer.begin()->structure);
     if (m_indexHeaderPairs.isEmpty())
       return;
   }
@@ -257,19 +262,18 @@ void CSV::Export::writeValues()
     const auto format = QStringLiteral("yyyy/MM/dd HH:mm:ss::zzz");
     m_textStream << i.rxDateTime.toString(format) << QStringLiteral(",");
 
-    // Obtain a set of unique dataset values (based on dataset index)
-    QMap<int, QString> fieldValues;
-    for (const auto &g : i.data.groups())
-    {
-      for (const auto &d : g.datasets())
-        fieldValues[d.index()] = d.value().simplified();
-    }
+    // Locate the value of each column within the records of this structure
+    if (i.structure != m_columnStructure) [[unlikely]]
+      mapColumns(i.structure);
 
     // Write data to output stream
-    for (int j = 0; j < m_indexHeaderPairs.count(); ++j)
+    for (int j = 0; j < m_columnValues.count(); ++j)
     {
-      m_textStream << fieldValues.value(m_indexHeaderPairs[j].first, "");
-      m_textStream << (j < m_indexHeaderPairs.count() - 1 ? "," : "\n");
+      const auto slot = m_columnValues[j];
+      if (slot >= 0 && slot < i.values.size()) [[likely]]
+        m_textStream << i.values[slot].value.simplified();
+
+      m_textStream << (j < m_columnValues.count() - 1 ? "," : "\n");
     }
   }
 
@@ -277,6 +281,36 @@ void CSV::Export::writeValues()
   m_textStream.flush();
 }
 
+/**
+ * @brief Maps each CSV column to the position of its value within the frame
+ *        records that use @a structure.
+ *
+ * When several datasets share the same index, the value of the last one is
+ * written, columns without a matching dataset are left empty.
+ *
+ * @param structure Frame structure shared by the records to write.
+ */
+void CSV::Export::mapColumns(
+    const std::shared_ptr<const JSON::Frame> &structure)
+{
+  // Obtain the position of the last dataset with each index
+  qsizetype position = 0;
+  QHash<int, qsizetype> positions;
+  for (const auto &g : structure->groups())
+  {
+    for (const auto &d : g.datasets())
+      positions.insert(d.index(), position++);
+  }
+
+  // Generate the column table
+  m_columnValues.clear();
+  m_columnValues.reserve(m_indexHeaderPairs.count());
+  for (const auto &pair : std::as_const(m_indexHeaderPairs))
+    m_columnValues.append(positions.value(pair.first, -1));
+
+  m_columnStructure = structure;
+}
+
 /**
  * @brief Creates a new CSV file and writes the header.
  *
@@ -34,47 +34,12 @@
 
 namespace CSV
 {
-/**
- * @brief Represents a single timestamped frame for CSV export.
- *
- * Stores a JSON frame and the associated reception timestamp (in local time).
- * Designed to be move-only for performance reasons, especially when using
- * concurrent queues.
- */
-struct TimestampFrame
-{
-  JSON::Frame data;     ///< The actual data frame.
-  QDateTime rxDateTime; ///< Time at which the frame was received.
-
-  /**
-   * @brief Default constructor.
-   */
-  TimestampFrame() {}
-
-  /**
-   * @brief Constructs a timestamped frame with current time.
-   *
-   * @param d The data frame (moved).
-   */
-  TimestampFrame(JSON::Frame &&d)
-    : data(std::move(d))
-    , rxDateTime(QDateTime::currentDateTime())
-  {
-  }
-
-  // Disable copy constructs and use standard move assignments
-  TimestampFrame(TimestampFrame &&) = default;
-  TimestampFrame(const TimestampFrame &) = delete;
-  TimestampFrame &operator=(TimestampFrame &&) = default;
-  TimestampFrame &operator=(const TimestampFrame &) = delete;
-};
-
 /**
  * @brief Handles CSV export of incoming data frames.
  *
- * The Export class collects incoming JSON frames tagged with a timestamp,
- * writes them asynchronously to a CSV file, and manages output buffering
- * and formatting.
+ * The Export class collects incoming frame records (dataset values tagged
+ * with a timestamp, which share the frame structure), writes them
+ * asynchronously to a CSV file, and manages output buffering and formatting.
  *
  * This class is implemented as a singleton and runs a background thread
  * to offload file I/O operations. It supports enabling/disabling export
@@ -117,13 +82,14 @@ public slots:
   void setupExternalConnections();
   void setExportEnabled(const bool enabled);
 
-  void hotpathTxFrame(const JSON::Frame &frame);
+  void hotpathTxFrame(const JSON::FrameRecord &record);
 
 private slots:
   void writeValues();
 
 private:
   QVector<QPair<int, QString>> createCsvFile(const JSON::Frame &frame);
+  void mapColumns(const std::shared_ptr<const JSON::Frame> &structure);
 
 private:
   QFile m_csvFile;
@@ -132,8 +98,10 @@ private:
   QTimer *m_workerTimer;
   QThread m_workerThread;
   QTextStream m_textStream;
-  std::vector<TimestampFrame> m_writeBuffer;
+  QVector<qsizetype> m_columnValues;
+  std::vector<JSON::FrameRecord> m_writeBuffer;
+  std::shared_ptr<const JSON::Frame> m_columnStructure;
   QVector<QPair<int, QString>> m_indexHeaderPairs;
-  moodycamel::ReaderWriterQueue<TimestampFrame> m_pendingFrames{8128};
+  moodycamel::ReaderWriterQueue<JSON::FrameRecord> m_pendingFrames{8128};
 };
 } // namespace CSV
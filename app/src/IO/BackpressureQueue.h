@@ -0,0 +1,389 @@
+/*
+ * Serial Studio
+ * https://serial-studio.com/
+ *
+ * Copyright (C) 2020–2025 Alex Spataru
+ *
+ * This file is dual-licensed:
+ *
+ * - Under the GNU GPLv3 (or later) for builds that exclude Pro modules.
+ * - Under the Serial Studio Commercial License for builds that include
+ *   any Pro functionality.
+ *
+ * You must comply with the terms of one of these licenses, depending
+ * on your use case.
+ *
+ * For GPL terms, see <https://www.gnu.org/licenses/gpl-3.0.html>
+ * For commercial terms, see LICENSE_COMMERCIAL.md in the project root.
+ *
+ * SPDX-License-Identifier: GPL-3.0-only OR LicenseRef-SerialStudio-Commercial
+ */
+
+#pragma once
+
+#include <deque>
+#include <limits>
+#include <atomic>
+#include <QMutex>
+#include <QtGlobal>
+#include <QDeadlineTimer>
+#include <QWaitCondition>
+
+#include "ThirdParty/readerwriterqueue.h"
+
+namespace IO
+{
+/**
+ * @brief Defines what happens when an item is produced while a bounded queue
+ *        is full (e.g. because the user interface thread stalls).
+ */
+enum class QueuePolicy
+{
+  DropOldest, /**< Discard the oldest queued item to make room. */
+  DropNewest, /**< Discard the item that was just produced. */
+  Block,      /**< Wait (bounded) for the consumer, then drop the item. */
+  Grow        /**< Allocate more queue space, never drop items. */
+};
+
+/**
+ * @brief Single-producer/single-consumer queue with a fixed capacity and a
+ *        configurable backpressure policy.
+ *
+ * When the queue is full, the QueuePolicy decides which item is lost:
+ * - DropNewest: the new item is discarded.
+ * - DropOldest: the new item is stored in additional queue space, and every
+ *   item that is no longer among the newest @c capacity ones is marked as
+ *   obsolete, the consumer discards it when it gets dequeued. If the consumer
+ *   falls more than a whole queue behind, new items are kept in a small
+ *   overflow list that the producer trims from the front, so the oldest live
+ *   item is still the one that is lost and memory usage stays bounded.
+ * - Block: waits up to BLOCK_TIMEOUT_MS for the consumer to make room, then
+ *   discards the new item. Only applies if the producer allows it, since
+ *   blocking the consumer's thread would never free space.
+ * - Grow: allocates more queue space, items are never discarded.
+ *
+ * Items are numbered in the order in which they enter the queue, so an item
+ * is only ever discarded if it really is obsolete, and every lost item is
+ * counted in dropped() once it is discarded.
+ *
+ * The lock-free queue is used on the fast path, the overflow list and the
+ * wait condition of the Block policy are only locked while the queue is full.
+ *
+ * @tparam T Type of the queued items.
+ */
+template<typename T>
+class BackpressureQueue
+{
+public:
+  static constexpr qint64 BLOCK_TIMEOUT_MS = 50;
+
+  /**
+   * @brief Constructs an empty queue that holds up to @a capacity items
+   *        before the backpressure policy kicks in.
+   */
+  explicit BackpressureQueue(const std::size_t capacity)
+    : m_capacity(capacity)
+    , m_policy(QueuePolicy::DropNewest)
+    , m_queuedItems(0)
+    , m_waiting(false)
+    , m_overflowCount(0)
+    , m_obsoleteItems(0)
+    , m_dropped(0)
+    , m_enqueued(0)
+    , m_peakOccupancy(0)
+    , m_queue(capacity)
+  {
+  }
+
+  /**
+   * @brief Returns the policy applied when the queue is full.
+   */
+  [[nodiscard]] QueuePolicy policy() const { return m_policy; }
+
+  /**
+   * @brief Changes the policy applied when the queue is full.
+   *
+   * Must only be called from the producer thread.
+   */
+  void setPolicy(const QueuePolicy policy) { m_policy = policy; }
+
+  /**
+   * @brief Returns the number of items lost because the queue was full.
+   */
+  [[nodiscard]] quint64 dropped() const
+  {
+    return m_dropped.load(std::memory_order_relaxed);
+  }
+
+  /**
+   * @brief Returns the number of items registered in the queue.
+   */
+  [[nodiscard]] quint64 enqueued() const
+  {
+    return m_enqueued.load(std::memory_order_relaxed);
+  }
+
+  /**
+   * @brief Returns the highest number of items that were waiting in the
+   *        queue at the same time.
+   */
+  [[nodiscard]] quint64 peakOccupancy() const
+  {
+    return m_peakOccupancy.load(std::memory_order_relaxed);
+  }
+
+  /**
+   * @brief Returns the approximate number of queued items, including the
+   *        obsolete ones that have not been discarded yet.
+   */
+  [[nodiscard]] std::size_t sizeApprox() const
+  {
+    return m_queue.size_approx()
+           + m_overflowCount.load(std::memory_order_relaxed);
+  }
+
+  /**
+   * @brief Registers @a item in the queue, applying backpressure.
+   *
+   * Must only be called from the producer thread.
+   *
+   * @param item     The item to register.
+   * @param mayBlock Whether the Block policy may wait for the consumer.
+   *
+   * @return @c true if the item was queued, @c false if it was discarded.
+   */
+  bool enqueue(T &&item, const bool mayBlock)
+  {
+    // Move items that overflowed the queue back in, oldest first
+    if (m_overflowCount.load(std::memory_order_acquire) > 0) [[unlikely]]
+      drainOverflow();
+
+    // Fast path, there is room in the queue
+    bool enqueued = false;
+    const auto sequence = m_queuedItems;
+    if (!isFull()) [[likely]]
+      enqueued = m_queue.enqueue(Entry{sequence, std::move(item)});
+
+    // Queue is full, apply backpressure policy
+    else
+    {
+      switch (m_policy)
+      {
+        case QueuePolicy::DropOldest:
+          m_obsoleteItems.store(sequence + 1 - m_capacity,
+                                std::memory_order_release);
+          enqueued = true;
+          if (m_overflowCount.load(std::memory_order_relaxed) == 0
+              && m_queue.size_approx() < 2 * m_capacity)
+            m_queue.enqueue(Entry{sequence, std::move(item)});
+          else
+            overflow(Entry{sequence, std::move(item)}, m_capacity);
+          break;
+        case QueuePolicy::Block:
+          if (mayBlock && waitForRoom())
+            enqueued = m_queue.enqueue(Entry{sequence, std::move(item)});
+          break;
+        case QueuePolicy::Grow:
+          enqueued = true;
+          if (m_overflowCount.load(std::memory_order_relaxed) == 0)
+            m_queue.enqueue(Entry{sequence, std::move(item)});
+          else
+            overflow(Entry{sequence, std::move(item)}, 0);
+          break;
+        default:
+          break;
+      }
+
+      // Account for the lost item
+      if (!enqueued)
+      {
+        m_dropped.fetch_add(1, std::memory_order_relaxed);
+        return false;
+      }
+    }
+
+    // Update statistics, obsolete items are not waiting to be processed
+    ++m_queuedItems;
+    m_enqueued.fetch_add(1, std::memory_order_relaxed);
+    const quint64 queued = sizeApprox();
+    const quint64 live
+        = m_queuedItems - m_obsoleteItems.load(std::memory_order_relaxed);
+    const quint64 occupancy = qMin(queued, live);
+    if (occupancy > m_peakOccupancy.load(std::memory_order_relaxed))
+      m_peakOccupancy.store(occupancy, std::memory_order_relaxed);
+
+    return true;
+  }
+
+  /**
+   * @brief Dequeues the oldest pending item.
+   *
+   * Must only be called from the consumer thread. Items that the producer has
+   * marked as obsolete are discarded and counted as dropped. A producer that
+   * waits for room with the Block policy is woken up afterwards.
+   *
+   * @param item Receives the dequeued item.
+   * @return @c true if an item was dequeued, @c false if the queue is empty.
+   */
+  bool dequeue(T &item)
+  {
+    bool taken = false;
+    bool delivered = false;
+    Entry entry;
+    while (takeEntry(entry))
+    {
+      // Item is among the newest queued items, deliver it
+      taken = true;
+      if (entry.sequence >= m_obsoleteItems.load(std::memory_order_acquire))
+        [[likely]]
+      {
+        item = std::move(entry.item);
+        delivered = true;
+        break;
+      }
+
+      // Item was overwritten by the drop-oldest policy
+      m_dropped.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    // Wake up the producer if it waits for room in the queue
+    if (taken)
+    {
+      std::atomic_thread_fence(std::memory_order_seq_cst);
+      if (m_waiting.load(std::memory_order_relaxed)) [[unlikely]]
+      {
+        QMutexLocker locker(&m_waitMutex);
+        m_roomAvailable.wakeAll();
+      }
+    }
+
+    return delivered;
+  }
+
+private:
+  /**
+   * @brief Queued item, tagged with the order in which it entered the queue.
+   */
+  struct Entry
+  {
+    quint64 sequence = 0;
+    T item;
+  };
+
+  /**
+   * @brief Returns @c true if new items cannot go straight into the queue.
+   */
+  [[nodiscard]] bool isFull() const
+  {
+    return m_overflowCount.load(std::memory_order_relaxed) > 0
+           || m_queue.size_approx() >= m_capacity;
+  }
+
+  /**
+   * @brief Stores @a entry behind the items of the overflow list.
+   *
+   * If @a limit is not zero, the oldest items of the list are discarded until
+   * it holds at most @a limit items. Every item in the queue is older than
+   * the list and already obsolete at that point, so the discarded items are
+   * the oldest live ones.
+   */
+  void overflow(Entry &&entry, const std::size_t limit)
+  {
+    QMutexLocker locker(&m_overflowMutex);
+    m_overflow.push_back(std::move(entry));
+    while (limit > 0 && m_overflow.size() > limit)
+    {
+      m_overflow.pop_front();
+      m_dropped.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    m_overflowCount.store(m_overflow.size(), std::memory_order_release);
+  }
+
+  /**
+   * @brief Moves items of the overflow list into the queue while the queue
+   *        has room for them, keeping their order.
+   */
+  void drainOverflow()
+  {
+    QMutexLocker locker(&m_overflowMutex);
+    const auto limit = m_policy == QueuePolicy::Grow
+                           ? std::numeric_limits<std::size_t>::max()
+                           : 2 * m_capacity;
+    while (!m_overflow.empty() && m_queue.size_approx() < limit)
+    {
+      m_queue.enqueue(std::move(m_overflow.front()));
+      m_overflow.pop_front();
+    }
+
+    m_overflowCount.store(m_overflow.size(), std::memory_order_release);
+  }
+
+  /**
+   * @brief Waits up to BLOCK_TIMEOUT_MS until the consumer makes room.
+   *
+   * @return @c true if a new item can be queued.
+   */
+  [[nodiscard]] bool waitForRoom()
+  {
+    QMutexLocker locker(&m_waitMutex);
+    m_waiting.store(true, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+
+    QDeadlineTimer deadline(BLOCK_TIMEOUT_MS);
+    while (isFull())
+    {
+      if (!m_roomAvailable.wait(&m_waitMutex, deadline))
+        break;
+    }
+
+    m_waiting.store(false, std::memory_order_relaxed);
+    return !isFull();
+  }
+
+  /**
+   * @brief Takes the oldest entry from the queue or from the overflow list.
+   */
+  bool takeEntry(Entry &entry)
+  {
+    if (m_queue.try_dequeue(entry)) [[likely]]
+      return true;
+
+    if (m_overflowCount.load(std::memory_order_acquire) == 0) [[likely]]
+      return false;
+
+    // The producer may have moved overflown items into the queue meanwhile
+    QMutexLocker locker(&m_overflowMutex);
+    if (m_queue.try_dequeue(entry))
+      return true;
+
+    if (m_overflow.empty())
+      return false;
+
+    entry = std::move(m_overflow.front());
+    m_overflow.pop_front();
+    m_overflowCount.store(m_overflow.size(), std::memory_order_release);
+    return true;
+  }
+
+private:
+  std::size_t m_capacity;
+  QueuePolicy m_policy;
+  quint64 m_queuedItems;
+
+  QMutex m_waitMutex;
+  QWaitCondition m_roomAvailable;
+  std::atomic_bool m_waiting;
+
+  QMutex m_overflowMutex;
+  std::deque<Entry> m_overflow;
+  std::atomic<std::size_t> m_overflowCount;
+
+  std::atomic<quint64> m_obsoleteItems;
+  std::atomic<quint64> m_dropped;
+  std::atomic<quint64> m_enqueued;
+  std::atomic<quint64> m_peakOccupancy;
+
+  moodycamel::ReaderWriterQueue<Entry> m_queue;
+};
+} // namespace IO
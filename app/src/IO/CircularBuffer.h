@@ -21,10 +21,20 @@
 
 #pragma once
 
+#include <bit>
 #include <vector>
 #include <cstring>
+#include <QVector>
 #include <QByteArray>
 
+#if defined(__AVX2__)
+#  include <immintrin.h>
+#elif defined(__SSE2__) || defined(_M_X64)                                     \
+    || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#  include <emmintrin.h>
+#  define CIRCULAR_BUFFER_SSE2
+#endif
+
 namespace IO
 {
 /**
@@ -43,6 +53,55 @@ template<typename T, typename StorageType = uint8_t>
 class CircularBuffer
 {
 public:
+  /**
+   * @brief Non-owning view over a byte range stored in the circular buffer.
+   *
+   * Because the range may wrap around the end of the ring, it is described by
+   * up to two contiguous segments. The view is only valid until the buffer is
+   * modified (e.g. by append(), read(), consume() or clear()).
+   */
+  struct View
+  {
+    const StorageType *first = nullptr;  ///< Segment up to the ring end
+    const StorageType *second = nullptr; ///< Wrapped segment (may be null)
+    qsizetype firstSize = 0;             ///< Number of elements in `first`
+    qsizetype secondSize = 0;            ///< Number of elements in `second`
+
+    [[nodiscard]] qsizetype size() const { return firstSize + secondSize; }
+    [[nodiscard]] bool isEmpty() const { return size() == 0; }
+    [[nodiscard]] bool isContiguous() const { return secondSize == 0; }
+
+    void copyTo(T &out) const;
+  };
+
+  /**
+   * @brief Stateful, incremental pattern searcher.
+   *
+   * Owns the precomputed KMP prefix table of a pattern together with the
+   * partial-match state of the last search. Passing the same searcher to
+   * findPattern() repeatedly (with the same starting position) resumes the
+   * scan where it stopped, so every byte of a large frame that arrives in
+   * small chunks is only examined once.
+   */
+  class Searcher
+  {
+  public:
+    explicit Searcher(const T &pattern = T());
+
+    void reset();
+    void setPattern(const T &pattern);
+    [[nodiscard]] const T &pattern() const { return m_pattern; }
+
+  private:
+    T m_pattern;            ///< Pattern to search for
+    std::vector<int> m_lps; ///< KMP longest-prefix-suffix table
+    qint64 m_origin;        ///< Absolute offset where the search started
+    qint64 m_position;      ///< Absolute offset of the next element to scan
+    int m_matched;          ///< Pattern elements matched before m_position
+
+    friend class CircularBuffer;
+  };
+
   explicit CircularBuffer(qsizetype capacity = 1024 * 1024 * 10);
 
   [[nodiscard]] StorageType &operator[](qsizetype index);
@@ -52,17 +111,32 @@ public:
   void setCapacity(const qsizetype capacity);
 
   [[nodiscard]] qsizetype size() const;
+  [[nodiscard]] qint64 headOffset() const;
   [[nodiscard]] qsizetype freeSpace() const;
 
   [[nodiscard]] T read(qsizetype size);
   [[nodiscard]] T peek(qsizetype size) const;
+  [[nodiscard]] T mid(qsizetype offset, qsizetype size) const;
+  [[nodiscard]] View view(qsizetype offset, qsizetype size) const;
+
+  void consume(qsizetype size);
 
   [[nodiscard]] int findPatternKMP(const T &pattern, const int pos = 0);
+  [[nodiscard]] int findPattern(Searcher &searcher, const int pos = 0) const;
+  [[nodiscard]] int findFirstOf(const QVector<T> &patterns, qsizetype &length,
+                                qint64 &cursor) const;
 
 private:
-  [[nodiscard]] std::vector<int> computeKMPTable(const T &p) const;
+  [[nodiscard]] static std::vector<int> computeKMPTable(const T &p);
+  [[nodiscard]] bool matchesAt(const T &pattern, qsizetype index) const;
+  [[nodiscard]] qsizetype findShortPattern(const T &pattern,
+                                           qsizetype from) const;
+
+  static qsizetype scanForAny(const StorageType *data, qsizetype size,
+                              const StorageType *set, int count);
 
 private:
+  qint64 m_headOffset;
   qsizetype m_size;
   qsizetype m_head;
   qsizetype m_tail;
@@ -71,6 +145,63 @@ private:
 };
 } // namespace IO
 
+/**
+ * @brief Copies the bytes referenced by the view into @a out.
+ *
+ * The output container is resized to fit the view, its storage is only
+ * reused if it is not shared and already large enough.
+ *
+ * @param out Destination container.
+ */
+template<typename T, typename StorageType>
+void IO::CircularBuffer<T, StorageType>::View::copyTo(T &out) const
+{
+  out.resize(size());
+  if (firstSize > 0)
+    std::memcpy(out.data(), first, firstSize * sizeof(StorageType));
+  if (secondSize > 0)
+    std::memcpy(out.data() + firstSize, second,
+                secondSize * sizeof(StorageType));
+}
+
+/**
+ * @brief Constructs a searcher for the given @a pattern.
+ *
+ * @param pattern The pattern to look for (may be empty and set later).
+ */
+template<typename T, typename StorageType>
+IO::CircularBuffer<T, StorageType>::Searcher::Searcher(const T &pattern)
+  : m_origin(-1)
+  , m_position(0)
+  , m_matched(0)
+{
+  setPattern(pattern);
+}
+
+/**
+ * @brief Discards the partial-match state, the next search starts over.
+ */
+template<typename T, typename StorageType>
+void IO::CircularBuffer<T, StorageType>::Searcher::reset()
+{
+  m_origin = -1;
+  m_position = 0;
+  m_matched = 0;
+}
+
+/**
+ * @brief Changes the pattern and rebuilds the KMP prefix table.
+ *
+ * @param pattern The new pattern to look for.
+ */
+template<typename T, typename StorageType>
+void IO::CircularBuffer<T, StorageType>::Searcher::setPattern(const T &pattern)
+{
+  m_pattern = pattern;
+  m_lps = CircularBuffer::computeKMPTable(pattern);
+  reset();
+}
+
 /**
  * @brief Constructs a CircularBuffer object with a given capacity.
  *
@@ -81,7 +212,8 @@ private:
  */
 template<typename T, typename StorageType>
 IO::CircularBuffer<T, StorageType>::CircularBuffer(qsizetype capacity)
-  : m_size(0)
+  : m_headOffset(0)
+  , m_size(0)
   , m_head(0)
   , m_tail(0)
   , m_capacity(capacity)
@@ -119,6 +251,7 @@ StorageType &IO::CircularBuffer<T, StorageType>::operator[](qsizetype index)
 template<typename T, typename StorageType>
 void IO::CircularBuffer<T, StorageType>::clear()
 {
+  m_headOffset += m_size;
   m_size = 0;
   m_head = 0;
   m_tail = 0;
@@ -153,6 +286,7 @@ void IO::CircularBuffer<T, StorageType>::append(const T &data)
   {
     const qsizetype overwrite = copySize - freeSpace();
     m_head = (m_head + overwrite) % m_capacity;
+    m_headOffset += overwrite;
     m_size -= overwrite;
   }
 
@@ -191,6 +325,22 @@ qsizetype IO::CircularBuffer<T, StorageType>::size() const
   return m_size;
 }
 
+/**
+ * @brief Returns the absolute stream offset of the buffer head.
+ *
+ * The offset counts every element that has ever been removed from the head of
+ * the buffer (read, consumed, overwritten or cleared). Callers can store
+ * positions as absolute offsets to remember how far they already scanned, and
+ * convert them back to logical indexes with `offset - headOffset()`.
+ *
+ * @return The absolute offset of the first element stored in the buffer.
+ */
+template<typename T, typename StorageType>
+qint64 IO::CircularBuffer<T, StorageType>::headOffset() const
+{
+  return m_headOffset;
+}
+
 /**
  * @brief Returns the free space available in the buffer.
  *
@@ -219,16 +369,8 @@ T IO::CircularBuffer<T, StorageType>::read(qsizetype size)
     throw std::underflow_error("Not enough data in buffer");
 
   T result;
-  result.resize(size);
-
-  const qsizetype firstChunk = std::min(size, m_capacity - m_head);
-  std::memcpy(result.data(), &m_buffer[m_head], firstChunk);
-
-  if (size > firstChunk)
-    std::memcpy(result.data() + firstChunk, &m_buffer[0], size - firstChunk);
-
-  m_head = (m_head + size) % m_capacity;
-  m_size -= size;
+  view(0, size).copyTo(result);
+  consume(size);
 
   return result;
 }
@@ -248,21 +390,87 @@ T IO::CircularBuffer<T, StorageType>::read(qsizetype size)
 template<typename T, typename StorageType>
 T IO::CircularBuffer<T, StorageType>::peek(qsizetype size) const
 {
-  size = std::min(size, m_size);
-
   T result;
-  result.resize(size);
+  view(0, size).copyTo(result);
+  return result;
+}
 
-  qsizetype firstChunk = std::min(size, m_capacity - m_head);
-  std::memcpy(result.data(), &m_buffer[m_head], firstChunk);
+/**
+ * @brief Copies an arbitrary range of the buffer without removing it.
+ *
+ * Unlike peek(), which always starts at the head, this function only touches
+ * the requested range, so reading a few trailing bytes (e.g. a checksum) costs
+ * O(size) regardless of how much data is queued in the buffer.
+ *
+ * @param offset Logical start of the range, relative to the buffer head.
+ * @param size   Number of elements to copy.
+ * @return The requested data. If the range exceeds the buffered data, the
+ *         result is truncated (or empty if @a offset is out of bounds).
+ */
+template<typename T, typename StorageType>
+T IO::CircularBuffer<T, StorageType>::mid(qsizetype offset,
+                                         qsizetype size) const
+{
+  T result;
+  view(offset, size).copyTo(result);
+  return result;
+}
 
-  if (size > firstChunk)
+/**
+ * @brief Returns a non-owning view over a range of the buffered data.
+ *
+ * No bytes are copied; the returned view points directly into the ring and
+ * describes the range with up to two segments when it wraps around the end of
+ * the internal storage.
+ *
+ * @param offset Logical start of the range, relative to the buffer head.
+ * @param size   Number of elements in the range. The range is clipped to the
+ *               data currently stored in the buffer.
+ * @return A view over the requested range (empty if out of bounds).
+ */
+template<typename T, typename StorageType>
+typename IO::CircularBuffer<T, StorageType>::View
+IO::CircularBuffer<T, StorageType>::view(qsizetype offset, qsizetype size) const
+{
+  View v;
+  if (offset < 0 || offset >= m_size || size <= 0)
+    return v;
+
+  size = std::min(size, m_size - offset);
+  const qsizetype start = (m_head + offset) % m_capacity;
+  v.first = m_buffer.data() + start;
+  v.firstSize = std::min(size, m_capacity - start);
+  if (size > v.firstSize)
   {
-    size_t secondChunk = size - firstChunk;
-    std::memcpy(result.data() + firstChunk, &m_buffer[0], secondChunk);
+    v.second = m_buffer.data();
+    v.secondSize = size - v.firstSize;
   }
 
-  return result;
+  return v;
+}
+
+/**
+ * @brief Discards data from the head of the buffer without copying it.
+ *
+ * This is the zero-copy counterpart of read(): it only advances the head
+ * pointer, which makes it suitable for dropping frames that have already been
+ * extracted through a View.
+ *
+ * @param size The number of elements to discard.
+ * @throws std::underflow_error if there is not enough data in the buffer.
+ */
+template<typename T, typename StorageType>
+void IO::CircularBuffer<T, StorageType>::consume(qsizetype size)
+{
+  if (size > m_size)
+    throw std::underflow_error("Not enough data in buffer");
+
+  if (size <= 0)
+    return;
+
+  m_head = (m_head + size) % m_capacity;
+  m_headOffset += size;
+  m_size -= size;
 }
 
 /**
@@ -297,6 +505,10 @@ int IO::CircularBuffer<T, StorageType>::findPatternKMP(const T &pattern,
   if (pattern.isEmpty() || m_size < pattern.size())
     return -1;
 
+  // Single and two-element delimiters are located with a vectorized scan
+  if (pattern.size() <= 2)
+    return static_cast<int>(findShortPattern(pattern, pos));
+
   // Start search at `pos`
   std::vector<int> lps = computeKMPTable(pattern);
   qsizetype bufferIdx = (m_head + pos) % m_capacity;
@@ -335,6 +547,372 @@ int IO::CircularBuffer<T, StorageType>::findPatternKMP(const T &pattern,
   return -1;
 }
 
+/**
+ * @brief Incrementally searches for the pattern of a Searcher.
+ *
+ * Works like findPatternKMP(), but uses the LPS table owned by @a searcher and
+ * continues from the position and partial-match state stored by the previous
+ * call. The saved state is reused as long as the absolute starting position
+ * (`headOffset() + pos`) did not change; otherwise, e.g. after data before
+ * the match was consumed, the search restarts at @a pos.
+ *
+ * If a match was already found and the caller did not consume it yet, the same
+ * index is returned immediately without scanning again.
+ *
+ * @param searcher The searcher holding the pattern and the scan state.
+ * @param pos      Starting position, relative to the buffer head.
+ *
+ * @return The logical index of the first occurrence of the pattern at or after
+ *         @a pos, or -1 if it is not (yet) present in the buffer.
+ */
+template<typename T, typename StorageType>
+int IO::CircularBuffer<T, StorageType>::findPattern(Searcher &searcher,
+                                                    const int pos) const
+{
+  // Validate search pattern
+  const auto &pattern = searcher.m_pattern;
+  const int m = static_cast<int>(pattern.size());
+  if (m == 0 || pos < 0)
+    return -1;
+
+  // Restart the search if the starting point moved
+  const qint64 origin = m_headOffset + pos;
+  if (searcher.m_origin != origin || searcher.m_position < origin)
+  {
+    searcher.m_origin = origin;
+    searcher.m_position = origin;
+    searcher.m_matched = 0;
+  }
+
+  // Pattern already found by a previous call
+  if (searcher.m_matched == m)
+    return static_cast<int>(searcher.m_position - m_headOffset - m);
+
+  // Short patterns, scan for the lead element and verify candidates
+  if (m <= 2)
+  {
+    const auto from = searcher.m_position - m_headOffset;
+    const auto index = findShortPattern(pattern, from);
+    if (index >= 0)
+    {
+      searcher.m_matched = m;
+      searcher.m_position = m_headOffset + index + m;
+      return static_cast<int>(index);
+    }
+
+    const qsizetype resume = std::max<qsizetype>(from, m_size - (m - 1));
+    searcher.m_position = m_headOffset + resume;
+    return -1;
+  }
+
+  // Resume the search where the previous call stopped
+  qsizetype i = static_cast<qsizetype>(searcher.m_position - m_headOffset);
+  qsizetype bufferIdx = (m_head + i) % m_capacity;
+  int j = searcher.m_matched;
+  while (i < m_size)
+  {
+    // Compare current buffer element with the pattern
+    if (m_buffer[bufferIdx] == static_cast<StorageType>(pattern[j]))
+    {
+      ++i;
+      ++j;
+      if (++bufferIdx == m_capacity)
+        bufferIdx = 0;
+
+      // Whole pattern matched, keep state until the match is consumed
+      if (j == m)
+        break;
+    }
+
+    // Mismatch after some matches, fall back in pattern
+    else if (j != 0)
+      j = searcher.m_lps[j - 1];
+
+    // Mismatch at the start, move forward
+    else
+    {
+      ++i;
+      if (++bufferIdx == m_capacity)
+        bufferIdx = 0;
+    }
+  }
+
+  // Save scan state
+  searcher.m_matched = j;
+  searcher.m_position = m_headOffset + i;
+
+  // Return the logical start index of the match (if any)
+  if (j == m)
+    return static_cast<int>(i - m);
+
+  return -1;
+}
+
+/**
+ * @brief Finds the earliest occurrence of any of the given patterns.
+ *
+ * Performs a single sweep over the buffer looking for the leading element of
+ * every pattern (using SSE2/AVX2 when available), and verifies the candidates
+ * in place. When several patterns match at the same position, the longest one
+ * wins (e.g. "\r\n" is preferred over "\r").
+ *
+ * The @a cursor stores the absolute stream offset (see headOffset()) where the
+ * next search should resume. Bytes that were already scanned without a match
+ * are therefore not scanned again when new data is appended, only the last
+ * `longest pattern - 1` bytes are revisited to catch delimiters that straddle
+ * two chunks. Initialize the cursor to 0 and keep it between calls.
+ *
+ * @param patterns The patterns to search for. Empty patterns are ignored.
+ * @param length   Receives the size of the matched pattern (0 if not found).
+ * @param cursor   Absolute resume offset, updated by the function.
+ *
+ * @return The logical index of the earliest match, or -1 if none was found.
+ */
+template<typename T, typename StorageType>
+int IO::CircularBuffer<T, StorageType>::findFirstOf(const QVector<T> &patterns,
+                                                    qsizetype &length,
+                                                    qint64 &cursor) const
+{
+  // Collect the distinct leading elements & the longest pattern size
+  int leadCount = 0;
+  qsizetype longest = 0;
+  StorageType leads[8];
+  bool verifyAll = false;
+  for (const auto &pattern : patterns)
+  {
+    if (pattern.isEmpty())
+      continue;
+
+    longest = std::max(longest, pattern.size());
+    const auto lead = static_cast<StorageType>(pattern[0]);
+    if (std::find(leads, leads + leadCount, lead) == leads + leadCount)
+    {
+      if (leadCount < 8)
+        leads[leadCount++] = lead;
+      else
+        verifyAll = true;
+    }
+  }
+
+  // Nothing to search for
+  length = 0;
+  if (leadCount == 0)
+    return -1;
+
+  // Resume where the previous search stopped
+  const qsizetype start
+      = static_cast<qsizetype>(std::clamp<qint64>(cursor - m_headOffset, 0,
+                                                  m_size));
+
+  // Scan both ring segments for candidate positions
+  const auto range = view(start, m_size - start);
+  const StorageType *segments[2] = {range.first, range.second};
+  const qsizetype sizes[2] = {range.firstSize, range.secondSize};
+  qsizetype base = start;
+  for (int s = 0; s < 2; ++s)
+  {
+    qsizetype offset = 0;
+    while (offset < sizes[s])
+    {
+      // Locate the next position that starts like one of the patterns
+      const auto idx = verifyAll ? 0
+                                 : scanForAny(segments[s] + offset,
+                                              sizes[s] - offset, leads,
+                                              leadCount);
+      if (idx < 0)
+        break;
+
+      // Verify candidates, keeping the longest match at this position
+      const qsizetype candidate = base + offset + idx;
+      for (const auto &pattern : patterns)
+      {
+        if (pattern.size() > length && matchesAt(pattern, candidate))
+          length = pattern.size();
+      }
+
+      // Match found, store cursor so that an incomplete frame resumes here
+      if (length > 0)
+      {
+        cursor = m_headOffset + candidate;
+        return static_cast<int>(candidate);
+      }
+
+      offset += idx + 1;
+    }
+
+    base += sizes[s];
+  }
+
+  // Not found, resume before the tail to catch split delimiters
+  const qsizetype resume = std::max(start, m_size - (longest - 1));
+  cursor = m_headOffset + std::max<qsizetype>(0, resume);
+  return -1;
+}
+
+/**
+ * @brief Checks whether @a pattern is stored at the given logical @a index.
+ *
+ * @param pattern The pattern to compare.
+ * @param index   Logical index (relative to the head) of the first element.
+ * @return @c true if the complete pattern is present at @a index.
+ */
+template<typename T, typename StorageType>
+bool IO::CircularBuffer<T, StorageType>::matchesAt(const T &pattern,
+                                                   qsizetype index) const
+{
+  const qsizetype size = pattern.size();
+  if (size == 0 || index < 0 || index + size > m_size)
+    return false;
+
+  qsizetype bufferIdx = (m_head + index) % m_capacity;
+  for (qsizetype i = 0; i < size; ++i)
+  {
+    if (m_buffer[bufferIdx] != static_cast<StorageType>(pattern[i]))
+      return false;
+
+    if (++bufferIdx == m_capacity)
+      bufferIdx = 0;
+  }
+
+  return true;
+}
+
+/**
+ * @brief Locates a pattern of one or two elements without KMP.
+ *
+ * Both contiguous ring segments are scanned for the first pattern element with
+ * scanForAny() (memchr or SIMD for byte storage), avoiding the per-element
+ * modulo of the generic search. Every hit is then verified with matchesAt(),
+ * which also handles a pattern split across the wrap-around point.
+ *
+ * @param pattern The pattern to look for, must not be empty.
+ * @param from    Logical index where the search starts.
+ * @return The logical index of the first match, or -1 if not found.
+ */
+template<typename T, typename StorageType>
+qsizetype IO::CircularBuffer<T, StorageType>::findShortPattern(const T &pattern,
+                                                               qsizetype from) const
+{
+  // Validate arguments
+  const qsizetype m = pattern.size();
+  if (m == 0 || from < 0 || from + m > m_size)
+    return -1;
+
+  // Scan both ring segments for the lead element
+  const StorageType lead = static_cast<StorageType>(pattern[0]);
+  const auto range = view(from, m_size - from);
+  const StorageType *segments[2] = {range.first, range.second};
+  const qsizetype sizes[2] = {range.firstSize, range.secondSize};
+  qsizetype base = from;
+  for (int s = 0; s < 2; ++s)
+  {
+    qsizetype offset = 0;
+    while (offset < sizes[s])
+    {
+      const auto idx
+          = scanForAny(segments[s] + offset, sizes[s] - offset, &lead, 1);
+      if (idx < 0)
+        break;
+
+      const qsizetype candidate = base + offset + idx;
+      if (m == 1 || matchesAt(pattern, candidate))
+        return candidate;
+
+      offset += idx + 1;
+    }
+
+    base += sizes[s];
+  }
+
+  // Pattern not found
+  return -1;
+}
+
+/**
+ * @brief Finds the first element of a contiguous block that belongs to a set.
+ *
+ * For byte-sized storage, 32 (AVX2) or 16 (SSE2) elements are compared against
+ * every member of the set per iteration, with a scalar loop handling the
+ * remaining tail and non-x86 targets.
+ *
+ * @param data  Pointer to the first element of the block.
+ * @param size  Number of elements in the block.
+ * @param set   Elements to look for.
+ * @param count Number of elements in @a set (1 to 8).
+ *
+ * @return Index of the first matching element, or -1 if there is none.
+ */
+template<typename T, typename StorageType>
+qsizetype IO::CircularBuffer<T, StorageType>::scanForAny(
+    const StorageType *data, qsizetype size, const StorageType *set, int count)
+{
+  qsizetype i = 0;
+
+  if constexpr (sizeof(StorageType) == 1)
+  {
+    // Single element, let the C library do the job
+    if (count == 1)
+    {
+      const void *hit = std::memchr(data, static_cast<unsigned char>(set[0]),
+                                    static_cast<size_t>(size));
+      if (!hit)
+        return -1;
+
+      return static_cast<const StorageType *>(hit) - data;
+    }
+
+#if defined(__AVX2__)
+    __m256i needles[8];
+    for (int n = 0; n < count; ++n)
+      needles[n] = _mm256_set1_epi8(static_cast<char>(set[n]));
+
+    for (; i + 32 <= size; i += 32)
+    {
+      const auto block = _mm256_loadu_si256(
+          reinterpret_cast<const __m256i *>(data + i));
+
+      __m256i hits = _mm256_cmpeq_epi8(block, needles[0]);
+      for (int n = 1; n < count; ++n)
+        hits = _mm256_or_si256(hits, _mm256_cmpeq_epi8(block, needles[n]));
+
+      const auto mask = static_cast<quint32>(_mm256_movemask_epi8(hits));
+      if (mask != 0)
+        return i + std::countr_zero(mask);
+    }
+#elif defined(CIRCULAR_BUFFER_SSE2)
+    __m128i needles[8];
+    for (int n = 0; n < count; ++n)
+      needles[n] = _mm_set1_epi8(static_cast<char>(set[n]));
+
+    for (; i + 16 <= size; i += 16)
+    {
+      const auto block
+          = _mm_loadu_si128(reinterpret_cast<const __m128i *>(data + i));
+
+      __m128i hits = _mm_cmpeq_epi8(block, needles[0]);
+      for (int n = 1; n < count; ++n)
+        hits = _mm_or_si128(hits, _mm_cmpeq_epi8(block, needles[n]));
+
+      const auto mask = static_cast<quint32>(_mm_movemask_epi8(hits));
+      if (mask != 0)
+        return i + std::countr_zero(mask);
+    }
+#endif
+  }
+
+  // Scalar fallback & tail
+  for (; i < size; ++i)
+  {
+    for (int n = 0; n < count; ++n)
+    {
+      if (data[i] == set[n])
+        return i;
+    }
+  }
+
+  return -1;
+}
+
 /**
  * @brief Computes the KMP table for a given p.
  *
@@ -344,8 +922,7 @@ int IO::CircularBuffer<T, StorageType>::findPatternKMP(const T &pattern,
  * @return A vector of integers representing the LPS table.
  */
 template<typename T, typename StorageType>
-std::vector<int>
-IO::CircularBuffer<T, StorageType>::computeKMPTable(const T &p) const
+std::vector<int> IO::CircularBuffer<T, StorageType>::computeKMPTable(const T &p)
 {
   qsizetype m = p.size();
   std::vector<int> lps(m, 0);
@@ -21,11 +21,42 @@
 
 #include "FrameReader.h"
 
+#include <QThread>
+#include <QCoreApplication>
+#include <QLoggingCategory>
+
 #include "IO/Manager.h"
 #include "IO/Checksum.h"
 #include "JSON/FrameBuilder.h"
 #include "JSON/ProjectModel.h"
 
+/**
+ * Logging category used to dump the raw buffer contents when a checksum fails.
+ * Disabled by default, enable it with:
+ * QT_LOGGING_RULES="serial-studio.io.checksum.debug=true"
+ */
+Q_LOGGING_CATEGORY(CHECKSUM_LOG, "serial-studio.io.checksum", QtWarningMsg)
+
+/**
+ * Minimum interval between two consecutive checksum mismatch reports.
+ */
+static constexpr qint64 CHECKSUM_LOG_INTERVAL_MS = 1000;
+
+/**
+ * Number of frames that the frame queue holds before backpressure kicks in.
+ */
+static constexpr size_t FRAME_QUEUE_CAPACITY = 4096;
+
+/**
+ * Number of drained frame buffers that the consumer may return for reuse.
+ */
+static constexpr size_t FRAME_POOL_CAPACITY = 256;
+
+/**
+ * Largest frame buffer that is kept for reuse, bigger ones are released.
+ */
+static constexpr qsizetype FRAME_POOL_MAX_BYTES = 64 * 1024;
+
 //------------------------------------------------------------------------------
 // Constructor function
 //------------------------------------------------------------------------------
@@ -41,20 +72,145 @@
  */
 IO::FrameReader::FrameReader(QObject *parent)
   : QObject(parent)
+  , m_maxBatchLatency(0)
+  , m_batchTimer(this)
+  , m_readyReadPending(false)
+  , m_readyReadSignals(0)
+  , m_coalescedSignals(0)
+  , m_checksumErrors(0)
   , m_checksumLength(0)
+  , m_quickPlotCursor(0)
   , m_operationMode(SerialStudio::QuickPlot)
   , m_frameDetectionMode(SerialStudio::EndDelimiterOnly)
   , m_circularBuffer(1024 * 1024 * 10)
+  , m_queue(FRAME_QUEUE_CAPACITY)
+  , m_recycledFrames(FRAME_POOL_CAPACITY)
 {
   m_quickPlotEndSequences.append(QByteArray("\n"));
   m_quickPlotEndSequences.append(QByteArray("\r"));
   m_quickPlotEndSequences.append(QByteArray("\r\n"));
 
+  m_batchTimer.setSingleShot(true);
+  m_batchTimer.setTimerType(Qt::PreciseTimer);
+  connect(&m_batchTimer, &QTimer::timeout, this,
+          &IO::FrameReader::notifyConsumer);
+
   setChecksum(IO::Manager::instance().checksumAlgorithm());
   setStartSequence(IO::Manager::instance().startSequence());
   setFinishSequence(IO::Manager::instance().finishSequence());
   setOperationMode(JSON::FrameBuilder::instance().operationMode());
   setFrameDetectionMode(JSON::ProjectModel::instance().frameDetection());
+  setMaxBatchLatency(IO::Manager::instance().frameBatchLatency());
+  setQueuePolicy(IO::Manager::instance().queuePolicy());
+}
+
+//------------------------------------------------------------------------------
+// Consumer notification & statistics
+//------------------------------------------------------------------------------
+
+/**
+ * @brief Dequeues the oldest pending frame.
+ *
+ * Must only be called from the consumer thread. Frames that the reader has
+ * marked as obsolete (QueuePolicy::DropOldest) are discarded first.
+ *
+ * @param frame Receives the dequeued frame.
+ * @return @c true if a frame was dequeued, @c false if the queue is empty.
+ */
+bool IO::FrameReader::dequeueFrame(QByteArray &frame)
+{
+  return m_queue.dequeue(frame);
+}
+
+/**
+ * @brief Returns the buffer of a processed frame to the reader for reuse.
+ *
+ * Must only be called from the consumer thread, once nothing else refers to
+ * the frame. Buffers that are still shared (e.g. with the frame parsing
+ * thread), that are too large, or that do not fit in the pool are released
+ * as usual.
+ *
+ * @param frame The processed frame.
+ */
+void IO::FrameReader::recycleFrame(QByteArray &&frame)
+{
+  if (!frame.isDetached() || frame.capacity() > FRAME_POOL_MAX_BYTES)
+    return;
+
+  (void)m_recycledFrames.try_enqueue(std::move(frame));
+}
+
+/**
+ * @brief Tells the reader that the consumer is about to drain the queue.
+ *
+ * Must be called by the consumer before dequeuing frames. Once acknowledged,
+ * the next frame that gets enqueued will trigger a new `readyRead()` signal,
+ * frames enqueued before the acknowledgement are picked up by the drain that
+ * follows it.
+ */
+void IO::FrameReader::acknowledgeReadyRead()
+{
+  m_readyReadPending.store(false);
+}
+
+/**
+ * @brief Returns the maximum time (in milliseconds) that frames may be held
+ *        back to deliver them in larger batches. Zero disables the delay.
+ */
+int IO::FrameReader::maxBatchLatency() const
+{
+  return m_maxBatchLatency;
+}
+
+/**
+ * @brief Returns the policy applied when the frame queue is full.
+ */
+IO::QueuePolicy IO::FrameReader::queuePolicy() const
+{
+  return m_queue.policy();
+}
+
+/**
+ * @brief Returns the number of frames lost because the queue was full.
+ */
+quint64 IO::FrameReader::framesDropped() const
+{
+  return m_queue.dropped();
+}
+
+/**
+ * @brief Returns the number of frames registered in the queue.
+ */
+quint64 IO::FrameReader::framesEnqueued() const
+{
+  return m_queue.enqueued();
+}
+
+/**
+ * @brief Returns the highest number of frames that were waiting in the queue
+ *        at the same time during this session.
+ */
+quint64 IO::FrameReader::peakQueueOccupancy() const
+{
+  return m_queue.peakOccupancy();
+}
+
+/**
+ * @brief Returns the number of `readyRead()` signals emitted so far.
+ */
+quint64 IO::FrameReader::readyReadSignals() const
+{
+  return m_readyReadSignals.load(std::memory_order_relaxed);
+}
+
+/**
+ * @brief Returns the number of `readyRead()` signals that were not emitted
+ *        because a previous notification was still pending or because frames
+ *        were batched until the latency window expired.
+ */
+quint64 IO::FrameReader::coalescedSignals() const
+{
+  return m_coalescedSignals.load(std::memory_order_relaxed);
 }
 
 //------------------------------------------------------------------------------
@@ -72,8 +228,8 @@ IO::FrameReader::FrameReader(QObject *parent)
  *   according to the configured delimiters.
  *
  * Parsed frames are enqueued for later processing. No signals are emitted
- * per frame to avoid UI flooding. Instead, a single `readyRead()` signal
- * notifies the consumer that new frames are available for reading.
+ * per frame to avoid UI flooding. Instead, notifyConsumer() wakes up the
+ * consumer with a single `readyRead()` signal per batch of frames.
  *
  * @param data Incoming byte stream from the device.
  */
@@ -82,7 +238,7 @@ void IO::FrameReader::processData(const QByteArray &data)
   // Parse frames immediately
   if (m_operationMode == SerialStudio::ProjectFile
       && m_frameDetectionMode == SerialStudio::NoDelimiters)
-    m_queue.try_enqueue(data);
+    enqueueFrame(QByteArray(data));
 
   // Parse frames using a circular buffer
   else
@@ -120,8 +276,8 @@ void IO::FrameReader::processData(const QByteArray &data)
     }
   }
 
-  // Update user interface
-  Q_EMIT readyRead();
+  // Notify the consumer if required
+  notifyConsumer();
 }
 
 //------------------------------------------------------------------------------
@@ -142,9 +298,46 @@ void IO::FrameReader::setChecksum(const QString &checksum)
   const auto &map = IO::checksumFunctionMap();
   const auto it = map.find(m_checksum);
   if (it != map.end())
-    m_checksumLength = it.value()("", 0).size();
+  {
+    m_checksumFunction = it.value();
+    m_checksumLength = m_checksumFunction("", 0).size();
+  }
+
   else
+  {
     m_checksumLength = 0;
+    m_checksumFunction = nullptr;
+  }
+}
+
+/**
+ * @brief Sets the maximum batching latency for frame delivery.
+ *
+ * With a latency of zero, `readyRead()` is emitted as soon as the queue goes
+ * from drained to non-empty. Otherwise, consecutive notifications are spaced
+ * at least @a ms milliseconds apart, so that frames arriving in between are
+ * delivered to the consumer as a single batch.
+ *
+ * @param ms Maximum batching latency in milliseconds.
+ */
+void IO::FrameReader::setMaxBatchLatency(const int ms)
+{
+  m_maxBatchLatency = qMax(0, ms);
+  if (m_maxBatchLatency == 0 && m_batchTimer.isActive())
+  {
+    m_batchTimer.stop();
+    notifyConsumer();
+  }
+}
+
+/**
+ * @brief Sets the policy applied when the frame queue is full.
+ *
+ * @param policy The new backpressure policy.
+ */
+void IO::FrameReader::setQueuePolicy(const IO::QueuePolicy policy)
+{
+  m_queue.setPolicy(policy);
 }
 
 /**
@@ -158,6 +351,8 @@ void IO::FrameReader::setChecksum(const QString &checksum)
 void IO::FrameReader::setStartSequence(const QByteArray &start)
 {
   m_startSequence = start;
+  m_startSearcher.setPattern(start);
+  m_nextStartSearcher.setPattern(start);
 }
 
 /**
@@ -171,6 +366,7 @@ void IO::FrameReader::setStartSequence(const QByteArray &start)
 void IO::FrameReader::setFinishSequence(const QByteArray &finish)
 {
   m_finishSequence = finish;
+  m_finishSearcher.setPattern(finish);
 }
 
 /**
@@ -187,6 +383,7 @@ void IO::FrameReader::setOperationMode(const SerialStudio::OperationMode mode)
   if (m_operationMode != SerialStudio::ProjectFile)
   {
     m_checksumLength = 0;
+    m_checksumFunction = nullptr;
     m_checksum = QLatin1String("");
   }
 }
@@ -207,6 +404,71 @@ void IO::FrameReader::setFrameDetectionMode(
   m_frameDetectionMode = mode;
 }
 
+//------------------------------------------------------------------------------
+// Frame queue & consumer wakeup coalescing
+//------------------------------------------------------------------------------
+
+/**
+ * @brief Registers an extracted frame in the queue, applying backpressure.
+ *
+ * When the queue is full, the configured QueuePolicy decides which frame is
+ * lost, see IO::BackpressureQueue. The Block policy only applies when the
+ * reader runs in its own thread, since blocking the consumer's thread would
+ * never free space.
+ *
+ * @param frame The frame to register.
+ */
+void IO::FrameReader::enqueueFrame(QByteArray &&frame)
+{
+  m_queue.enqueue(std::move(frame), thread() != qApp->thread());
+}
+
+/**
+ * @brief Emits `readyRead()` only when the consumer needs to be woken up.
+ *
+ * A queued cross-thread signal is expensive compared to the frames it
+ * announces, so notifications are coalesced:
+ * - Nothing is emitted while the queue is empty.
+ * - Nothing is emitted while a previous notification has not been
+ *   acknowledged yet, the pending drain will pick up the new frames.
+ * - If a batching latency is configured, notifications are delayed until the
+ *   latency window since the last one has expired.
+ *
+ * Every suppressed notification is counted in coalescedSignals().
+ */
+void IO::FrameReader::notifyConsumer()
+{
+  // Nothing to deliver
+  if (m_queue.sizeApprox() == 0)
+    return;
+
+  // Hold frames back until the batching window expires
+  if (m_maxBatchLatency > 0 && m_lastReadyRead.isValid())
+  {
+    const auto elapsed = m_lastReadyRead.elapsed();
+    if (elapsed < m_maxBatchLatency)
+    {
+      if (!m_batchTimer.isActive())
+        m_batchTimer.start(static_cast<int>(m_maxBatchLatency - elapsed));
+
+      m_coalescedSignals.fetch_add(1, std::memory_order_relaxed);
+      return;
+    }
+  }
+
+  // Consumer has not drained the queue since the last notification
+  if (m_readyReadPending.exchange(true))
+  {
+    m_coalescedSignals.fetch_add(1, std::memory_order_relaxed);
+    return;
+  }
+
+  // Wake up the consumer
+  m_lastReadyRead.start();
+  m_readyReadSignals.fetch_add(1, std::memory_order_relaxed);
+  Q_EMIT readyRead();
+}
+
 //------------------------------------------------------------------------------
 // Frame detection functions
 //------------------------------------------------------------------------------
@@ -219,7 +481,8 @@ void IO::FrameReader::setFrameDetectionMode(
  * before the delimiter, validates the trailing checksum, and emits the frame
  * if valid.
  *
- * - In Quick Plot: searches for the first matching end delimiter from a list.
+ * - In Quick Plot: searches for the earliest line ending (CR, LF or CRLF) in
+ *   a single pass, resuming where the previous search stopped.
  * - In Project mode: uses a single configured delimiter.
  *
  * The checksum is expected immediately after the delimiter.
@@ -230,48 +493,40 @@ void IO::FrameReader::readEndDelimitedFrames()
   {
     // Initialize parameters
     int endIndex = -1;
-    QByteArray delimiter;
+    qsizetype delimiterSize = 0;
 
-    // Look for the earliest finish sequence (QuickPlot mode)
+    // Look for the earliest finish sequence in a single pass (QuickPlot mode)
     if (m_operationMode == SerialStudio::QuickPlot)
     {
-      for (const QByteArray &d : std::as_const(m_quickPlotEndSequences))
-      {
-        int index = m_circularBuffer.findPatternKMP(d);
-        if (index != -1 && (endIndex == -1 || index < endIndex))
-        {
-          endIndex = index;
-          delimiter = d;
-          break;
-        }
-      }
+      endIndex = m_circularBuffer.findFirstOf(
+          m_quickPlotEndSequences, delimiterSize, m_quickPlotCursor);
     }
 
     // Or use fixed delimiter (project mode)
     else if (m_frameDetectionMode == SerialStudio::EndDelimiterOnly)
     {
-      delimiter = m_finishSequence;
-      endIndex = m_circularBuffer.findPatternKMP(delimiter);
+      delimiterSize = m_finishSequence.size();
+      endIndex = m_circularBuffer.findPattern(m_finishSearcher);
     }
 
     // No frame found
     if (endIndex == -1)
       break;
 
-    // Extract frame data
-    const auto frame = m_circularBuffer.peek(endIndex);
-    const auto crcPosition = endIndex + delimiter.size();
+    // Locate frame data without copying it
+    const auto frame = m_circularBuffer.view(0, endIndex);
+    const auto crcPosition = endIndex + delimiterSize;
     const auto frameEndPos = crcPosition + m_checksumLength;
 
     // Read frame
     if (!frame.isEmpty())
     {
       // Validate checksum & register the frame
-      auto result = checksum(frame, crcPosition);
+      auto result = extractFrame(frame, crcPosition);
       if (result == ValidationStatus::FrameOk)
       {
-        m_queue.try_enqueue(std::move(frame));
-        (void)m_circularBuffer.read(frameEndPos);
+        enqueueFrame(std::move(m_frame));
+        m_circularBuffer.consume(frameEndPos);
       }
 
       // Incomplete data to calculate checksum
@@ -280,12 +535,12 @@ void IO::FrameReader::readEndDelimitedFrames()
 
       // Incorrect checksum
       else
-        (void)m_circularBuffer.read(frameEndPos);
+        m_circularBuffer.consume(frameEndPos);
     }
 
     // Invalid frame
     else
-      (void)m_circularBuffer.read(frameEndPos);
+      m_circularBuffer.consume(frameEndPos);
   }
 }
 
@@ -304,13 +559,13 @@ void IO::FrameReader::readStartDelimitedFrames()
   while (true)
   {
     // Find the first start delimiter in the buffer
-    int startIndex = m_circularBuffer.findPatternKMP(m_startSequence);
+    int startIndex = m_circularBuffer.findPattern(m_startSearcher);
     if (startIndex == -1)
       break;
 
     // Try to find the next start delimiter after this one
-    int nextStartIndex = m_circularBuffer.findPatternKMP(
-        m_startSequence, startIndex + m_startSequence.size());
+    int nextStartIndex = m_circularBuffer.findPattern(
+        m_nextStartSearcher, startIndex + m_startSequence.size());
 
     // Calculate start and end positions of the current frame
     qsizetype frameEndPos;
@@ -332,7 +587,7 @@ void IO::FrameReader::readStartDelimitedFrames()
     qsizetype frameLength = frameEndPos - frameStart;
     if (frameLength <= 0)
     {
-      (void)m_circularBuffer.read(frameEndPos);
+      m_circularBuffer.consume(frameEndPos);
       continue;
     }
 
@@ -340,23 +595,23 @@ void IO::FrameReader::readStartDelimitedFrames()
     const auto crcPosition = frameEndPos - m_checksumLength;
     if (crcPosition < frameStart)
     {
-      (void)m_circularBuffer.read(frameEndPos);
+      m_circularBuffer.consume(frameEndPos);
       continue;
     }
 
-    // Build the frame byte array
-    const auto frame = m_circularBuffer.peek(frameEndPos)
-                           .mid(frameStart, frameLength - m_checksumLength);
+    // Locate the frame payload without copying it
+    const auto frame = m_circularBuffer.view(frameStart,
+                                             frameLength - m_checksumLength);
 
     // Validate the frame
     if (!frame.isEmpty())
     {
       // Execute checksum algorithm and register the frame
-      const auto result = checksum(frame, crcPosition);
+      const auto result = extractFrame(frame, crcPosition);
       if (result == ValidationStatus::FrameOk)
       {
-        m_queue.try_enqueue(std::move(frame));
-        (void)m_circularBuffer.read(frameEndPos);
+        enqueueFrame(std::move(m_frame));
+        m_circularBuffer.consume(frameEndPos);
       }
 
       // Not enough bytes yet to compute checksum, wait for more
@@ -365,12 +620,12 @@ void IO::FrameReader::readStartDelimitedFrames()
 
       // Invalid checksum...discard and move on
       else
-        (void)m_circularBuffer.read(frameEndPos);
+        m_circularBuffer.consume(frameEndPos);
     }
 
     // Empty frame or invalid data, discard...
     else
-      (void)m_circularBuffer.read(frameEndPos);
+      m_circularBuffer.consume(frameEndPos);
   }
 }
 
@@ -390,15 +645,15 @@ void IO::FrameReader::readStartEndDelimitedFrames()
   while (true)
   {
     // Locate end delimiter
-    int finishIndex = m_circularBuffer.findPatternKMP(m_finishSequence);
+    int finishIndex = m_circularBuffer.findPattern(m_finishSearcher);
     if (finishIndex == -1)
       break;
 
     // Locate start delimiter and ensure it's before the end
-    int startIndex = m_circularBuffer.findPatternKMP(m_startSequence);
+    int startIndex = m_circularBuffer.findPattern(m_startSearcher);
     if (startIndex == -1 || startIndex >= finishIndex)
     {
-      (void)m_circularBuffer.read(finishIndex + m_finishSequence.size());
+      m_circularBuffer.consume(finishIndex + m_finishSequence.size());
       continue;
     }
 
@@ -407,25 +662,24 @@ void IO::FrameReader::readStartEndDelimitedFrames()
     qsizetype frameLength = finishIndex - frameStart;
     if (frameLength <= 0)
     {
-      (void)m_circularBuffer.read(finishIndex + m_finishSequence.size());
+      m_circularBuffer.consume(finishIndex + m_finishSequence.size());
       continue;
     }
 
-    // Extract frame data
+    // Locate frame data without copying it
     const auto crcPosition = finishIndex + m_finishSequence.size();
     const auto frameEndPos = crcPosition + m_checksumLength;
-    const auto frame = m_circularBuffer.peek(frameStart + frameLength)
-                           .mid(frameStart, frameLength);
+    const auto frame = m_circularBuffer.view(frameStart, frameLength);
 
     // Read frame
     if (!frame.isEmpty())
     {
       // Validate checksum and register the frame
-      auto result = checksum(frame, crcPosition);
+      auto result = extractFrame(frame, crcPosition);
       if (result == ValidationStatus::FrameOk)
       {
-        m_queue.try_enqueue(std::move(frame));
-        (void)m_circularBuffer.read(frameEndPos);
+        enqueueFrame(std::move(m_frame));
+        m_circularBuffer.consume(frameEndPos);
       }
 
       // Incomplete data to calculate checksum
@@ -434,19 +688,51 @@ void IO::FrameReader::readStartEndDelimitedFrames()
 
       // Incorrect checksum
       else
-        (void)m_circularBuffer.read(frameEndPos);
+        m_circularBuffer.consume(frameEndPos);
     }
 
     // Invalid frame
     else
-      (void)m_circularBuffer.read(frameEndPos);
+      m_circularBuffer.consume(frameEndPos);
   }
 }
 
 //------------------------------------------------------------------------------
-// Checksum validation function
+// Frame extraction & checksum validation functions
 //------------------------------------------------------------------------------
 
+/**
+ * @brief Materializes a detected frame and validates its checksum.
+ *
+ * The frame bytes are copied exactly once from the circular buffer into the
+ * @c m_frame container, which the caller then moves into the frame queue if
+ * validation succeeds, so every queued frame owns its own buffer. Buffers
+ * returned by the consumer through recycleFrame() are reused before a new one
+ * is allocated. The checksum is verified before the copy so that incomplete
+ * frames (waiting for more CRC bytes) are never materialized.
+ *
+ * @param frame View over the frame payload inside the circular buffer.
+ * @param crcPosition The byte offset in the buffer where the checksum begins.
+ *
+ * @return The validation status reported by checksum().
+ */
+IO::ValidationStatus
+IO::FrameReader::extractFrame(const CircularBuffer<QByteArray, char>::View &frame,
+                              qsizetype crcPosition)
+{
+  // Wait until all checksum bytes are available
+  if (m_circularBuffer.size() < crcPosition + m_checksumLength)
+    return ValidationStatus::ChecksumIncomplete;
+
+  // Reuse a buffer returned by the consumer instead of allocating a new one
+  if (m_frame.capacity() == 0)
+    (void)m_recycledFrames.try_dequeue(m_frame);
+
+  // Copy the frame into a byte array & validate it
+  frame.copyTo(m_frame);
+  return checksum(m_frame, crcPosition);
+}
+
 /**
  * @brief Validates the checksum of a frame against trailing data in the buffer.
  *
@@ -465,27 +751,43 @@ IO::ValidationStatus IO::FrameReader::checksum(const QByteArray &frame,
                                                qsizetype crcPosition)
 {
   // Early stop if checksum is null
-  if (m_checksumLength == 0)
+  if (m_checksumLength == 0 || !m_checksumFunction)
     return ValidationStatus::FrameOk;
 
   // Validate that we can read the checksum
-  const auto buffer = m_circularBuffer.peek(m_circularBuffer.size());
-  if (buffer.size() < crcPosition + m_checksumLength)
+  if (m_circularBuffer.size() < crcPosition + m_checksumLength)
     return ValidationStatus::ChecksumIncomplete;
 
-  // Compare actual vs received checksum
-  const auto calculated = IO::checksum(m_checksum, frame);
-  const QByteArray received = buffer.mid(crcPosition, m_checksumLength);
+  // Compare actual vs received checksum, only copying the checksum bytes
+  const auto calculated = m_checksumFunction(frame.data(), frame.size());
+  const auto received = m_circularBuffer.mid(crcPosition, m_checksumLength);
   if (calculated == received)
     return ValidationStatus::FrameOk;
 
+  // Rate-limit mismatch reports, a noisy link can fail thousands of frames/s
+  ++m_checksumErrors;
+  if (m_checksumLogTimer.isValid()
+      && m_checksumLogTimer.elapsed() < CHECKSUM_LOG_INTERVAL_MS)
+    return ValidationStatus::ChecksumError;
+
   // Log checksum mismatch
   qWarning() << "\n"
-             << m_checksum.toStdString().c_str() << "failed:\n"
+             << m_checksum.toStdString().c_str() << "failed"
+             << "(" << m_checksumErrors << "error(s) since last report):\n"
              << "\t- Received:" << received.toHex(' ') << "\n"
              << "\t- Calculated:" << calculated.toHex(' ') << "\n"
-             << "\t- Frame:" << frame.toHex(' ') << "\n"
-             << "\t- Buffer:" << buffer.toHex(' ');
+             << "\t- Frame:" << frame.toHex(' ');
+
+  // Only dump the buffer contents up to the checksum if explicitly requested
+  if (CHECKSUM_LOG().isDebugEnabled())
+  {
+    const auto end = crcPosition + m_checksumLength;
+    qCDebug(CHECKSUM_LOG) << "Buffer:" << m_circularBuffer.peek(end).toHex(' ');
+  }
+
+  // Reset rate limiter
+  m_checksumErrors = 0;
+  m_checksumLogTimer.start();
 
   // Return error
   return ValidationStatus::ChecksumError;
@@ -21,12 +21,17 @@
 
 #pragma once
 
+#include <QTimer>
+#include <atomic>
 #include <QObject>
 #include <QByteArray>
+#include <QElapsedTimer>
 
 #include "SerialStudio.h"
-#include "ThirdParty/readerwriterqueue.h"
+#include "IO/Checksum.h"
 #include "IO/CircularBuffer.h"
+#include "IO/BackpressureQueue.h"
+#include "ThirdParty/readerwriterqueue.h"
 
 namespace IO
 {
@@ -56,7 +61,17 @@ signals:
 public:
   explicit FrameReader(QObject *parent = nullptr);
 
-  inline moodycamel::ReaderWriterQueue<QByteArray> &queue() { return m_queue; }
+  bool dequeueFrame(QByteArray &frame);
+  void recycleFrame(QByteArray &&frame);
+
+  void acknowledgeReadyRead();
+  [[nodiscard]] QueuePolicy queuePolicy() const;
+  [[nodiscard]] quint64 framesDropped() const;
+  [[nodiscard]] quint64 framesEnqueued() const;
+  [[nodiscard]] quint64 peakQueueOccupancy() const;
+  [[nodiscard]] int maxBatchLatency() const;
+  [[nodiscard]] quint64 readyReadSignals() const;
+  [[nodiscard]] quint64 coalescedSignals() const;
 
 public slots:
   void processData(const QByteArray &data);
@@ -66,25 +81,51 @@ public slots:
   void setFinishSequence(const QByteArray &finish);
   void setOperationMode(const SerialStudio::OperationMode mode);
   void setFrameDetectionMode(const SerialStudio::FrameDetection mode);
+  void setMaxBatchLatency(const int ms);
+  void setQueuePolicy(const IO::QueuePolicy policy);
+
+private slots:
+  void notifyConsumer();
 
 private:
+  void enqueueFrame(QByteArray &&frame);
+
   void readEndDelimitedFrames();
   void readStartDelimitedFrames();
   void readStartEndDelimitedFrames();
 
+  ValidationStatus
+  extractFrame(const CircularBuffer<QByteArray, char>::View &frame,
+               qsizetype crcPosition);
   ValidationStatus checksum(const QByteArray &frame, qsizetype crcPosition);
 
 private:
+  int m_maxBatchLatency;
+  QTimer m_batchTimer;
+  QElapsedTimer m_lastReadyRead;
+  std::atomic_bool m_readyReadPending;
+  std::atomic<quint64> m_readyReadSignals;
+  std::atomic<quint64> m_coalescedSignals;
+
+  quint64 m_checksumErrors;
   qsizetype m_checksumLength;
+  qint64 m_quickPlotCursor;
+  ChecksumFunc m_checksumFunction;
+  QElapsedTimer m_checksumLogTimer;
   SerialStudio::OperationMode m_operationMode;
   SerialStudio::FrameDetection m_frameDetectionMode;
 
   QString m_checksum;
+  QByteArray m_frame;
   QByteArray m_startSequence;
   QByteArray m_finishSequence;
   QVector<QByteArray> m_quickPlotEndSequences;
 
   CircularBuffer<QByteArray, char> m_circularBuffer;
-  moodycamel::ReaderWriterQueue<QByteArray> m_queue{4096};
+  CircularBuffer<QByteArray, char>::Searcher m_startSearcher;
+  CircularBuffer<QByteArray, char>::Searcher m_finishSearcher;
+  CircularBuffer<QByteArray, char>::Searcher m_nextStartSearcher;
+  BackpressureQueue<QByteArray> m_queue;
+  moodycamel::ReaderWriterQueue<QByteArray> m_recycledFrames;
 };
 } // namespace IO
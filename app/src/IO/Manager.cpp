@@ -33,6 +33,7 @@
 
 #include "MQTT/Client.h"
 #include "Misc/Utilities.h"
+#include "Misc/TimerEvents.h"
 #include "IO/Drivers/Audio.h"
 
 #ifdef BUILD_COMMERCIAL
@@ -56,15 +57,27 @@ IO::Manager::Manager()
   : m_paused(false)
   , m_writeEnabled(true)
   , m_threadedFrameExtraction(false)
+  , m_queuePolicy(defaultQueuePolicyIndex())
+  , m_frameBatchLatency(0)
   , m_driver(nullptr)
   , m_workerThread(nullptr)
   , m_frameReader(nullptr)
   , m_startSequence(QByteArray("/*"))
   , m_finishSequence(QByteArray("*/"))
+  , m_framesDropped(0)
+  , m_framesEnqueued(0)
+  , m_coalescedSignals(0)
+  , m_readyReadSignals(0)
+  , m_peakQueueOccupancy(0)
 {
   m_frame.reserve(4096);
+  m_frameBatch.reserve(4096);
   m_threadedFrameExtraction
       = m_settings.value("threadedFrameExtraction", true).toBool();
+  m_frameBatchLatency = m_settings.value("frameBatchLatency", 0).toInt();
+  m_queuePolicy = qBound(0,
+                         m_settings.value("queuePolicy", m_queuePolicy).toInt(),
+                         static_cast<int>(QueuePolicy::Grow));
 
   setBusType(SerialStudio::BusType::UART);
   connect(this, &IO::Manager::busTypeChanged, this,
@@ -201,6 +214,120 @@ bool IO::Manager::threadedFrameExtraction()
   return m_threadedFrameExtraction;
 }
 
+/**
+ * @brief Returns the maximum time (in milliseconds) that the frame reader may
+ *        hold back frames in order to deliver them in larger batches.
+ *
+ * A value of zero delivers frames as soon as the consumer is idle.
+ */
+int IO::Manager::frameBatchLatency() const
+{
+  return m_frameBatchLatency;
+}
+
+/**
+ * @brief Returns the index of the frame queue backpressure policy, matching
+ *        the order of availableQueuePolicies().
+ */
+int IO::Manager::queuePolicyIndex() const
+{
+  return m_queuePolicy;
+}
+
+/**
+ * @brief Returns the index of the backpressure policy used when no setting
+ *        has been stored, matching the order of availableQueuePolicies().
+ */
+int IO::Manager::defaultQueuePolicyIndex() const
+{
+  return static_cast<int>(QueuePolicy::DropNewest);
+}
+
+/**
+ * @brief Returns the policy that the frame reader applies when its queue is
+ *        full.
+ */
+IO::QueuePolicy IO::Manager::queuePolicy() const
+{
+  return static_cast<QueuePolicy>(m_queuePolicy);
+}
+
+/**
+ * @brief Returns a list with the translated names of the available frame
+ *        queue backpressure policies.
+ *
+ * The order matches the IO::QueuePolicy enumeration.
+ */
+QStringList IO::Manager::availableQueuePolicies() const
+{
+  QStringList list;
+  list.append(tr("Drop Oldest Frames"));
+  list.append(tr("Drop Newest Frames"));
+  list.append(tr("Wait for Dashboard"));
+  list.append(tr("Grow Queue"));
+  return list;
+}
+
+/**
+ * @brief Returns the number of frames lost in the current session because
+ *        the frame queue was full.
+ */
+quint64 IO::Manager::framesDropped() const
+{
+  return m_framesDropped;
+}
+
+/**
+ * @brief Returns the number of frames queued in the current session.
+ */
+quint64 IO::Manager::framesEnqueued() const
+{
+  return m_framesEnqueued;
+}
+
+/**
+ * @brief Returns the number of frame reader wakeups that were coalesced into
+ *        a previous one in the current session.
+ */
+quint64 IO::Manager::coalescedSignals() const
+{
+  return m_coalescedSignals;
+}
+
+/**
+ * @brief Returns the number of frame reader wakeups emitted in the current
+ *        session.
+ */
+quint64 IO::Manager::readyReadSignals() const
+{
+  return m_readyReadSignals;
+}
+
+/**
+ * @brief Returns the highest number of frames that waited in the frame queue
+ *        at the same time during the current session.
+ */
+quint64 IO::Manager::peakQueueOccupancy() const
+{
+  return m_peakQueueOccupancy;
+}
+
+/**
+ * @brief Returns all frame queue statistics in a single map, used by the
+ *        plugin server to report whether frames are being lost.
+ */
+QVariantMap IO::Manager::queueStatistics() const
+{
+  QVariantMap map;
+  map.insert(QStringLiteral("policy"), m_queuePolicy);
+  map.insert(QStringLiteral("enqueued"), m_framesEnqueued);
+  map.insert(QStringLiteral("dropped"), m_framesDropped);
+  map.insert(QStringLiteral("peakOccupancy"), m_peakQueueOccupancy);
+  map.insert(QStringLiteral("readyReadSignals"), m_readyReadSignals);
+  map.insert(QStringLiteral("coalescedSignals"), m_coalescedSignals);
+  return map;
+}
+
 /**
  * @brief Retrieves the current hardware abstraction layer (HAL) driver.
  *
@@ -391,14 +518,18 @@ void IO::Manager::connectDevice()
 /**
  * @brief Disconnects from the current device.
  *
- * Closes the connection to the device, clears the frame reader buffer, and
- * disconnects any associated signals. Emits signals to update the UI and
- * reflect the new state.
+ * Delivers the frames that were already extracted, closes the connection to
+ * the device, clears the frame reader buffer, and disconnects any associated
+ * signals. Emits signals to update the UI and reflect the new state.
  */
 void IO::Manager::disconnectDevice()
 {
   if (driver())
   {
+    // Deliver the frames that are still queued or being parsed
+    onReadyRead();
+    JSON::FrameBuilder::instance().flushPipeline();
+
     // Close driver device
     driver()->close();
     setPaused(false);
@@ -440,6 +571,11 @@ void IO::Manager::setupExternalConnections()
 {
   connect(&Misc::Translator::instance(), &Misc::Translator::languageChanged,
           this, &IO::Manager::busListChanged);
+  connect(&Misc::Translator::instance(), &Misc::Translator::languageChanged,
+          this, &IO::Manager::queuePolicyListChanged);
+
+  connect(&Misc::TimerEvents::instance(), &Misc::TimerEvents::timeout1Hz, this,
+          &IO::Manager::updateQueueStatistics);
 }
 
 //------------------------------------------------------------------------------
@@ -558,6 +694,64 @@ void IO::Manager::setChecksumAlgorithm(const QString &algorithm)
   Q_EMIT checksumAlgorithmChanged();
 }
 
+/**
+ * @brief Sets the policy applied when the frame reader's queue is full.
+ *
+ * The value is stored in persistent settings and applied to the active frame
+ * reader (if any) through a queued call.
+ *
+ * @param policy Index of the policy in availableQueuePolicies().
+ */
+void IO::Manager::setQueuePolicy(const int policy)
+{
+  const auto value = qBound(0, policy, static_cast<int>(QueuePolicy::Grow));
+  if (m_queuePolicy != value)
+  {
+    m_queuePolicy = value;
+    m_settings.setValue("queuePolicy", value);
+
+    if (m_frameReader)
+    {
+      QPointer<FrameReader> reader = m_frameReader;
+      const auto queuePolicy = static_cast<QueuePolicy>(value);
+      QMetaObject::invokeMethod(
+          reader,
+          [reader, queuePolicy] {
+            if (reader)
+              reader->setQueuePolicy(queuePolicy);
+          },
+          Qt::QueuedConnection);
+    }
+
+    Q_EMIT queuePolicyChanged();
+  }
+}
+
+/**
+ * @brief Sets the maximum batching latency of the frame reader.
+ *
+ * The value is stored in persistent settings and applied to the active frame
+ * reader (if any) through a queued call, since the reader may live in the
+ * worker thread.
+ *
+ * @param latency Maximum batching latency in milliseconds, zero to disable.
+ */
+void IO::Manager::setFrameBatchLatency(const int latency)
+{
+  const auto value = qBound(0, latency, 1000);
+  if (m_frameBatchLatency != value)
+  {
+    m_frameBatchLatency = value;
+    m_settings.setValue("frameBatchLatency", value);
+
+    if (m_frameReader)
+      QMetaObject::invokeMethod(m_frameReader, "setMaxBatchLatency",
+                                Qt::QueuedConnection, Q_ARG(int, value));
+
+    Q_EMIT frameBatchLatencyChanged();
+  }
+}
+
 /**
  * @brief Enables or disables threaded frame extraction.
  *
@@ -729,6 +923,14 @@ void IO::Manager::startFrameReader()
   // Stop the frame reader thread if needed
   killFrameReader();
 
+  // Reset frame queue statistics for the new session
+  m_framesDropped = 0;
+  m_framesEnqueued = 0;
+  m_coalescedSignals = 0;
+  m_readyReadSignals = 0;
+  m_peakQueueOccupancy = 0;
+  Q_EMIT queueStatisticsChanged();
+
   // Create new thread and frame reader instance
   m_frameReader = new FrameReader();
   if (!m_frameReader)
@@ -764,11 +966,16 @@ void IO::Manager::startFrameReader()
 /**
  * @brief Processes dequeued frames and routes them to consumers.
  *
- * Called when new frames are available in the frame reader's queue.
- * Pulls frames in a loop and dispatches them to the appropriate handlers:
+ * Called when new frames are available in the frame reader's queue. The
+ * notification is acknowledged first, so that frames enqueued while draining
+ * trigger a new wakeup, then all queued frames are moved into a batch that is
+ * dispatched in a single pass to:
  * - The JSON FrameBuilder for internal parsing.
  * - The MQTT client (if enabled) for external transmission.
  *
+ * The buffers of the dispatched frames are then returned to the frame reader,
+ * which reuses them for the next frames instead of allocating new ones.
+ *
  * Frame dispatch occurs only when the system is not paused.
  */
 void IO::Manager::onReadyRead()
@@ -777,17 +984,67 @@ void IO::Manager::onReadyRead()
   static auto &mqtt = MQTT::Client::instance();
 
   auto reader = m_frameReader;
-  if (!m_paused && reader) [[likely]]
+  if (!reader) [[unlikely]]
+    return;
+
+  reader->acknowledgeReadyRead();
+  if (!m_paused) [[likely]]
   {
-    auto &queue = reader->queue();
-    while (queue.try_dequeue(m_frame))
+    // Drain the queue into a batch
+    m_frameBatch.clear();
+    while (reader->dequeueFrame(m_frame))
+      m_frameBatch.append(std::move(m_frame));
+
+    // Dispatch the batch
+    if (!m_frameBatch.isEmpty())
+    {
+      frameBuilder.hotpathRxFrames(m_frameBatch);
+      for (const auto &frame : std::as_const(m_frameBatch))
+        mqtt.hotpathTxFrame(frame);
+    }
+
+    // Return the frame buffers to the reader, unless the batch was handed
+    // to another thread that still refers to it
+    if (m_frameBatch.isDetached())
     {
-      frameBuilder.hotpathRxFrame(m_frame);
-      mqtt.hotpathTxFrame(m_frame);
+      for (auto &frame : m_frameBatch)
+        reader->recycleFrame(std::move(frame));
     }
   }
 }
 
+/**
+ * @brief Copies the frame queue statistics of the active frame reader.
+ *
+ * Called at 1 Hz, the counters are updated atomically by the frame reader
+ * and the cached values remain available after the reader is destroyed.
+ * Frames lost by the frame parsing thread are included in the dropped count.
+ */
+void IO::Manager::updateQueueStatistics()
+{
+  auto reader = m_frameReader;
+  if (!reader)
+    return;
+
+  const auto dropped = reader->framesDropped()
+                       + JSON::FrameBuilder::instance().framesDropped();
+  const auto enqueued = reader->framesEnqueued();
+  const auto coalesced = reader->coalescedSignals();
+  const auto readyRead = reader->readyReadSignals();
+  const auto peak = reader->peakQueueOccupancy();
+  if (dropped != m_framesDropped || enqueued != m_framesEnqueued
+      || coalesced != m_coalescedSignals || readyRead != m_readyReadSignals
+      || peak != m_peakQueueOccupancy)
+  {
+    m_framesDropped = dropped;
+    m_framesEnqueued = enqueued;
+    m_coalescedSignals = coalesced;
+    m_readyReadSignals = readyRead;
+    m_peakQueueOccupancy = peak;
+    Q_EMIT queueStatisticsChanged();
+  }
+}
+
 /**
  * @brief Handles raw data received from the device.
  *
@@ -64,6 +64,35 @@ class Manager : public QObject
              READ threadedFrameExtraction
              WRITE setThreadedFrameExtraction
              NOTIFY threadedFrameExtractionChanged)
+  Q_PROPERTY(int frameBatchLatency
+             READ frameBatchLatency
+             WRITE setFrameBatchLatency
+             NOTIFY frameBatchLatencyChanged)
+  Q_PROPERTY(int queuePolicy
+             READ queuePolicyIndex
+             WRITE setQueuePolicy
+             NOTIFY queuePolicyChanged)
+  Q_PROPERTY(QStringList availableQueuePolicies
+             READ availableQueuePolicies
+             NOTIFY queuePolicyListChanged)
+  Q_PROPERTY(int defaultQueuePolicy
+             READ defaultQueuePolicyIndex
+             CONSTANT)
+  Q_PROPERTY(quint64 framesEnqueued
+             READ framesEnqueued
+             NOTIFY queueStatisticsChanged)
+  Q_PROPERTY(quint64 framesDropped
+             READ framesDropped
+             NOTIFY queueStatisticsChanged)
+  Q_PROPERTY(quint64 peakQueueOccupancy
+             READ peakQueueOccupancy
+             NOTIFY queueStatisticsChanged)
+  Q_PROPERTY(quint64 readyReadSignals
+             READ readyReadSignals
+             NOTIFY queueStatisticsChanged)
+  Q_PROPERTY(quint64 coalescedSignals
+             READ coalescedSignals
+             NOTIFY queueStatisticsChanged)
   Q_PROPERTY(SerialStudio::BusType busType
              READ busType
              WRITE setBusType
@@ -100,6 +129,10 @@ signals:
   void startSequenceChanged();
   void finishSequenceChanged();
   void checksumAlgorithmChanged();
+  void queuePolicyChanged();
+  void queuePolicyListChanged();
+  void frameBatchLatencyChanged();
+  void queueStatisticsChanged();
   void threadedFrameExtractionChanged();
 
 private:
@@ -120,6 +153,19 @@ public:
   [[nodiscard]] bool isConnected();
   [[nodiscard]] bool configurationOk();
   [[nodiscard]] bool threadedFrameExtraction();
+  [[nodiscard]] int frameBatchLatency() const;
+
+  [[nodiscard]] int queuePolicyIndex() const;
+  [[nodiscard]] int defaultQueuePolicyIndex() const;
+  [[nodiscard]] IO::QueuePolicy queuePolicy() const;
+  [[nodiscard]] QStringList availableQueuePolicies() const;
+
+  [[nodiscard]] quint64 framesDropped() const;
+  [[nodiscard]] quint64 framesEnqueued() const;
+  [[nodiscard]] quint64 coalescedSignals() const;
+  [[nodiscard]] quint64 readyReadSignals() const;
+  [[nodiscard]] quint64 peakQueueOccupancy() const;
+  [[nodiscard]] QVariantMap queueStatistics() const;
 
   [[nodiscard]] HAL_Driver *driver();
   [[nodiscard]] SerialStudio::BusType busType() const;
@@ -144,6 +190,8 @@ public slots:
   void setStartSequence(const QByteArray &sequence);
   void setFinishSequence(const QByteArray &sequence);
   void setChecksumAlgorithm(const QString &algorithm);
+  void setQueuePolicy(const int policy);
+  void setFrameBatchLatency(const int latency);
   void setThreadedFrameExtraction(const bool enabled);
   void setBusType(const SerialStudio::BusType &driver);
 
@@ -152,12 +200,15 @@ private:
   void startFrameReader();
 
   void onReadyRead();
+  void updateQueueStatistics();
   void onDataReceived(const QByteArray &data);
 
 private:
   bool m_paused;
   bool m_writeEnabled;
   bool m_threadedFrameExtraction;
+  int m_queuePolicy;
+  int m_frameBatchLatency;
   SerialStudio::BusType m_busType;
 
   HAL_Driver *m_driver;
@@ -165,10 +216,17 @@ private:
   QPointer<FrameReader> m_frameReader;
 
   QByteArray m_frame;
+  QList<QByteArray> m_frameBatch;
   QByteArray m_startSequence;
   QByteArray m_finishSequence;
 
   QSettings m_settings;
   QString m_checksumAlgorithm;
+
+  quint64 m_framesDropped;
+  quint64 m_framesEnqueued;
+  quint64 m_coalescedSignals;
+  quint64 m_readyReadSignals;
+  quint64 m_peakQueueOccupancy;
 };
 } // namespace IO
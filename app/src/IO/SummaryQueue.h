@@ -0,0 +1,443 @@
+/*
+ * Serial Studio
+ * https://serial-studio.com/
+ *
+ * Copyright (C) 2020–2025 Alex Spataru
+ *
+ * This file is dual-licensed:
+ *
+ * - Under the GNU GPLv3 (or later) for builds that exclude Pro modules.
+ * - Under the Serial Studio Commercial License for builds that include
+ *   any Pro functionality.
+ *
+ * You must comply with the terms of one of these licenses, depending
+ * on your use case.
+ *
+ * For GPL terms, see <https://www.gnu.org/licenses/gpl-3.0.html>
+ * For commercial terms, see LICENSE_COMMERCIAL.md in the project root.
+ *
+ * SPDX-License-Identifier: GPL-3.0-only OR LicenseRef-SerialStudio-Commercial
+ */
+
+#pragma once
+
+#include <deque>
+#include <limits>
+#include <vector>
+#include <algorithm>
+
+#include "IO/FixedQueue.h"
+
+namespace IO
+{
+/**
+ * @brief A FixedQueue of doubles that keeps a min/max/mean summary pyramid.
+ *
+ * The circular buffer is split into blocks of BLOCK_SIZE slots. Every block
+ * stores the minimum, maximum and sum of its samples, and a segment tree built
+ * on top of the blocks combines them into larger windows. Both are updated
+ * incrementally by push(), at a cost of O(log n).
+ *
+ * Queries over any window of the queue read the summaries of the blocks that
+ * are fully contained in the window, and only scan the samples of the (at
+ * most four) partially covered blocks at its edges. This makes the minimum,
+ * maximum and mean of a window an O(log n) operation, regardless of the
+ * number of samples it holds.
+ *
+ * The minimum and maximum of the whole queue are also tracked with a pair of
+ * monotonic deques (sliding-window min/max), so that autoscaling a plot takes
+ * constant time. Each sample enters and leaves the deques once, which keeps
+ * push() at an amortized O(1) for this part.
+ *
+ * The queue also counts the adjacent samples that decrease in value, which
+ * tells in constant time if the queue is sorted in ascending order (e.g. to
+ * binary-search the X axis of a plot).
+ *
+ * The samples can only be modified through push(), fill(), fillRange(),
+ * clear() and resize(), so that the summaries always match the buffer.
+ */
+class SummaryQueue : public FixedQueue<double>
+{
+public:
+  /**
+   * @brief Aggregated statistics of a window of samples.
+   *
+   * @c minIndex and @c maxIndex are logical indexes (0 = front of the queue).
+   */
+  struct Summary
+  {
+    double min = std::numeric_limits<double>::max();
+    double max = std::numeric_limits<double>::lowest();
+    double sum = 0;
+    std::size_t count = 0;
+    std::size_t minIndex = 0;
+    std::size_t maxIndex = 0;
+
+    /**
+     * @brief Returns the mean value of the window, or 0 if it is empty.
+     */
+    [[nodiscard]] double mean() const
+    {
+      return count > 0 ? sum / static_cast<double>(count) : 0;
+    }
+  };
+
+  /**
+   * @brief Number of slots summarized by each block of the pyramid.
+   */
+  static constexpr std::size_t BLOCK_SIZE = 64;
+
+  /**
+   * @brief Constructs a SummaryQueue with a given capacity.
+   * @param capacity Maximum number of elements the queue can hold.
+   */
+  explicit SummaryQueue(std::size_t capacity = 100)
+    : FixedQueue<double>(capacity)
+    , m_sequence(0)
+    , m_descents(0)
+  {
+    allocate();
+  }
+
+  /**
+   * @brief Provides read-only access to an element at a given index.
+   *
+   * Mutable access is not provided, as it would bypass the summaries.
+   *
+   * @param index Index relative to the logical front of the queue.
+   * @return Reference to the element at the specified index.
+   * @throws std::out_of_range if index is invalid.
+   */
+  [[nodiscard]] const double &operator[](std::size_t index) const
+  {
+    return FixedQueue<double>::operator[](index);
+  }
+
+  /**
+   * @brief Returns a raw pointer to the internal buffer (read-only).
+   * @return Pointer to the beginning of the internal array.
+   */
+  [[nodiscard]] const double *raw() const { return FixedQueue<double>::raw(); }
+
+  /**
+   * @brief Checks whether the samples are sorted in ascending order.
+   * @return True if no sample is smaller than the one before it.
+   */
+  [[nodiscard]] bool monotonic() const { return m_descents == 0; }
+
+  /**
+   * @brief Returns the smallest sample in the queue in constant time.
+   * @return The minimum value, or 0 if the queue is empty.
+   */
+  [[nodiscard]] double minimum() const
+  {
+    return m_minima.empty() ? 0 : valueAt(m_minima.front());
+  }
+
+  /**
+   * @brief Returns the largest sample in the queue in constant time.
+   * @return The maximum value, or 0 if the queue is empty.
+   */
+  [[nodiscard]] double maximum() const
+  {
+    return m_maxima.empty() ? 0 : valueAt(m_maxima.front());
+  }
+
+  /**
+   * @brief Returns the statistics of every sample in the queue.
+   */
+  [[nodiscard]] Summary summary() const { return summary(0, size()); }
+
+  /**
+   * @brief Returns the statistics of a window of samples.
+   *
+   * The window is clamped to the contents of the queue.
+   *
+   * @param first Logical index of the first sample of the window.
+   * @param count Number of samples in the window.
+   * @return Minimum, maximum, sum and location of the extremes of the window.
+   */
+  [[nodiscard]] Summary summary(std::size_t first, std::size_t count) const
+  {
+    Summary result;
+    if (first >= size())
+      return result;
+
+    count = std::min(count, size() - first);
+    if (count == 0)
+      return result;
+
+    // Split the window into at most two contiguous physical ranges
+    const std::size_t cap = capacity();
+    const std::size_t begin = (frontIndex() + first) % cap;
+    if (begin + count <= cap)
+      query(begin, begin + count, result);
+    else
+    {
+      query(begin, cap, result);
+      query(0, begin + count - cap, result);
+    }
+
+    // Convert the location of the extremes to logical indexes
+    result.minIndex = (result.minIndex + cap - frontIndex()) % cap;
+    result.maxIndex = (result.maxIndex + cap - frontIndex()) % cap;
+    return result;
+  }
+
+  /**
+   * @brief Inserts an element. Overwrites oldest element if full.
+   * @param item The element to insert.
+   */
+  void push(const double item)
+  {
+    // Stop tracking the order of the element that is about to be overwritten
+    if (full() && size() > 1)
+    {
+      if (FixedQueue<double>::operator[](1) < front())
+        --m_descents;
+    }
+
+    // Track the order of the new element
+    if (!empty() && capacity() > 1 && item < back())
+      ++m_descents;
+
+    // Insert the element
+    const std::size_t slot = (frontIndex() + size()) % capacity();
+    FixedQueue<double>::push(item);
+
+    // Update the sliding-window extremes
+    const auto sequence = m_sequence++;
+    const auto oldest = m_sequence - size();
+    while (!m_minima.empty() && m_minima.front() < oldest)
+      m_minima.pop_front();
+    while (!m_maxima.empty() && m_maxima.front() < oldest)
+      m_maxima.pop_front();
+
+    track(sequence, item);
+
+    // Restart the block summary when its first slot is overwritten, older
+    // samples in the block are only read through partial block scans
+    auto &leaf = m_tree[m_blocks + slot / BLOCK_SIZE];
+    if (slot % BLOCK_SIZE == 0)
+      leaf = Summary();
+
+    combine(leaf, item, slot);
+
+    // Update the upper levels of the pyramid
+    for (auto node = (m_blocks + slot / BLOCK_SIZE) / 2; node > 0; node /= 2)
+      m_tree[node] = merge(m_tree[2 * node], m_tree[2 * node + 1]);
+  }
+
+  /**
+   * @brief Clears all elements from the queue.
+   */
+  void clear()
+  {
+    FixedQueue<double>::clear();
+    m_minima.clear();
+    m_maxima.clear();
+    m_sequence = 0;
+    m_descents = 0;
+  }
+
+  /**
+   * @brief Fills the queue with a repeated value, overwriting all contents.
+   * @param value The value to fill.
+   */
+  void fill(const double value)
+  {
+    FixedQueue<double>::fill(value);
+    rebuild();
+  }
+
+  /**
+   * @brief Fills the queue with increasing values starting from a given base.
+   * @param start Starting value.
+   * @param step  Increment step (default: 1).
+   */
+  void fillRange(const double start, const double step = 1)
+  {
+    FixedQueue<double>::fillRange(start, step);
+    rebuild();
+  }
+
+  /**
+   * @brief Resizes the queue to a new capacity, preserving the most recent
+   *        elements.
+   *
+   * @param newCapacity The desired new capacity of the queue.
+   */
+  void resize(std::size_t newCapacity)
+  {
+    if (newCapacity == capacity())
+      return;
+
+    FixedQueue<double>::resize(newCapacity);
+    allocate();
+    rebuild();
+  }
+
+private:
+  /**
+   * @brief Returns the value of the sample that was pushed with the given
+   *        sequence number, which must still be in the queue.
+   */
+  [[nodiscard]] double valueAt(const std::size_t sequence) const
+  {
+    const auto index = sequence - (m_sequence - size());
+    return raw()[(frontIndex() + index) % capacity()];
+  }
+
+  /**
+   * @brief Adds the newest sample to the sliding-window extremes, dropping
+   *        the older samples that can no longer be the minimum or maximum.
+   */
+  void track(const std::size_t sequence, const double value)
+  {
+    while (!m_minima.empty() && valueAt(m_minima.back()) >= value)
+      m_minima.pop_back();
+    while (!m_maxima.empty() && valueAt(m_maxima.back()) <= value)
+      m_maxima.pop_back();
+
+    m_minima.push_back(sequence);
+    m_maxima.push_back(sequence);
+  }
+
+  /**
+   * @brief Adds the sample stored at @a slot to @a summary.
+   */
+  static void combine(Summary &summary, const double value,
+                      const std::size_t slot)
+  {
+    if (summary.count == 0 || value < summary.min)
+    {
+      summary.min = value;
+      summary.minIndex = slot;
+    }
+
+    if (summary.count == 0 || value > summary.max)
+    {
+      summary.max = value;
+      summary.maxIndex = slot;
+    }
+
+    summary.sum += value;
+    ++summary.count;
+  }
+
+  /**
+   * @brief Combines the summaries of two windows.
+   */
+  [[nodiscard]] static Summary merge(const Summary &a, const Summary &b)
+  {
+    if (a.count == 0)
+      return b;
+    if (b.count == 0)
+      return a;
+
+    Summary result = a;
+    if (b.min < a.min)
+    {
+      result.min = b.min;
+      result.minIndex = b.minIndex;
+    }
+
+    if (b.max > a.max)
+    {
+      result.max = b.max;
+      result.maxIndex = b.maxIndex;
+    }
+
+    result.sum += b.sum;
+    result.count += b.count;
+    return result;
+  }
+
+  /**
+   * @brief Adds the statistics of the physical slots [begin, end) to
+   *        @a result.
+   *
+   * Blocks that are fully contained in the range are read from the pyramid,
+   * the slots of partially covered blocks are scanned.
+   */
+  void query(const std::size_t begin, const std::size_t end,
+             Summary &result) const
+  {
+    const double *data = raw();
+    const std::size_t cap = capacity();
+
+    // Obtain the blocks that are fully contained in the range
+    auto lo = (begin + BLOCK_SIZE - 1) / BLOCK_SIZE;
+    auto hi = end == cap ? m_blocks : end / BLOCK_SIZE;
+
+    // No complete blocks, scan the samples
+    if (lo >= hi)
+    {
+      for (auto i = begin; i < end; ++i)
+        combine(result, data[i], i);
+
+      return;
+    }
+
+    // Scan the samples before and after the complete blocks
+    for (auto i = begin; i < lo * BLOCK_SIZE; ++i)
+      combine(result, data[i], i);
+    for (auto i = hi * BLOCK_SIZE; i < end; ++i)
+      combine(result, data[i], i);
+
+    // Combine the summaries of the complete blocks
+    for (lo += m_blocks, hi += m_blocks; lo < hi; lo /= 2, hi /= 2)
+    {
+      if (lo & 1)
+        result = merge(result, m_tree[lo++]);
+      if (hi & 1)
+        result = merge(result, m_tree[--hi]);
+    }
+  }
+
+  /**
+   * @brief Allocates the pyramid for the current capacity of the queue.
+   */
+  void allocate()
+  {
+    m_blocks = std::max<std::size_t>(1, (capacity() + BLOCK_SIZE - 1)
+                                            / BLOCK_SIZE);
+    m_tree.assign(2 * m_blocks, Summary());
+  }
+
+  /**
+   * @brief Recalculates every summary from the samples in the queue.
+   *
+   * Only called after operations that leave the front of the queue at the
+   * start of the internal buffer.
+   */
+  void rebuild()
+  {
+    std::fill(m_tree.begin(), m_tree.end(), Summary());
+
+    m_minima.clear();
+    m_maxima.clear();
+    m_descents = 0;
+    m_sequence = size();
+    const double *data = raw();
+    for (std::size_t i = 0; i < size(); ++i)
+    {
+      track(i, data[i]);
+      combine(m_tree[m_blocks + i / BLOCK_SIZE], data[i], i);
+      if (i > 0 && data[i] < data[i - 1])
+        ++m_descents;
+    }
+
+    for (auto node = m_blocks - 1; node > 0; --node)
+      m_tree[node] = merge(m_tree[2 * node], m_tree[2 * node + 1]);
+  }
+
+private:
+  std::size_t m_blocks;             ///< Number of blocks in the buffer.
+  std::size_t m_sequence;           ///< Number of samples pushed so far.
+  std::size_t m_descents;           ///< Adjacent samples in descending order.
+  std::vector<Summary> m_tree;      ///< Block summaries and segment tree.
+  std::deque<std::size_t> m_minima; ///< Sequences of candidate minimums.
+  std::deque<std::size_t> m_maxima; ///< Sequences of candidate maximums.
+};
+} // namespace IO
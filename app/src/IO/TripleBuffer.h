@@ -0,0 +1,126 @@
+/*
+ * Serial Studio
+ * https://serial-studio.com/
+ *
+ * Copyright (C) 2020–2025 Alex Spataru
+ *
+ * This file is dual-licensed:
+ *
+ * - Under the GNU GPLv3 (or later) for builds that exclude Pro modules.
+ * - Under the Serial Studio Commercial License for builds that include
+ *   any Pro functionality.
+ *
+ * You must comply with the terms of one of these licenses, depending
+ * on your use case.
+ *
+ * For GPL terms, see <https://www.gnu.org/licenses/gpl-3.0.html>
+ * For commercial terms, see LICENSE_COMMERCIAL.md in the project root.
+ *
+ * SPDX-License-Identifier: GPL-3.0-only OR LicenseRef-SerialStudio-Commercial
+ */
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <cstddef>
+
+namespace IO
+{
+/**
+ * @brief A lock-free triple buffer for handing data from one writer thread to
+ *        one reader thread.
+ *
+ * The writer always owns the back buffer and the reader always owns the front
+ * buffer, the third buffer holds the most recently published data. Publishing
+ * and taking data are single atomic exchanges of buffer indexes, so neither
+ * thread ever waits for the other, and a buffer is never accessed by both
+ * threads at the same time.
+ *
+ * The reader only sees complete buffers. If the writer publishes several
+ * times between two updates of the reader, the intermediate buffers are
+ * skipped and the reader gets the newest one.
+ *
+ * @tparam T Type of the buffered data.
+ */
+template<typename T>
+class TripleBuffer
+{
+public:
+  /**
+   * @brief Constructs a triple buffer with default-constructed buffers.
+   */
+  TripleBuffer()
+    : m_back(0)
+    , m_front(1)
+    , m_middle(2)
+  {
+  }
+
+  TripleBuffer(const TripleBuffer &) = delete;
+  TripleBuffer &operator=(const TripleBuffer &) = delete;
+
+  /**
+   * @brief Returns the buffer owned by the writer.
+   * @return Reference to the back buffer.
+   */
+  [[nodiscard]] T &back() { return m_buffers[m_back]; }
+
+  /**
+   * @brief Returns the index (0-2) of the buffer owned by the writer.
+   *
+   * Allows the writer to keep per-buffer bookkeeping, e.g. to know how up to
+   * date each buffer is when it gets it back.
+   */
+  [[nodiscard]] std::size_t backIndex() const { return m_back; }
+
+  /**
+   * @brief Publishes the back buffer and takes a new one.
+   *
+   * Must only be called by the writer. The new back buffer holds whatever
+   * data it had when it was last published, it is up to the writer to bring
+   * it up to date.
+   */
+  void publish()
+  {
+    const auto previous = m_middle.exchange(
+        static_cast<std::uint8_t>(m_back | DIRTY), std::memory_order_acq_rel);
+    m_back = previous & INDEX_MASK;
+  }
+
+  /**
+   * @brief Returns the buffer owned by the reader.
+   * @return Reference to the front buffer.
+   */
+  [[nodiscard]] const T &front() const { return m_buffers[m_front]; }
+
+  /**
+   * @brief Takes the most recently published buffer, if any.
+   *
+   * Must only be called by the reader. References to the previous front
+   * buffer must not be used after this function returns @c true.
+   *
+   * @return @c true if the front buffer changed, @c false otherwise.
+   */
+  bool update()
+  {
+    if (!(m_middle.load(std::memory_order_relaxed) & DIRTY))
+      return false;
+
+    const auto previous = m_middle.exchange(static_cast<std::uint8_t>(m_front),
+                                            std::memory_order_acq_rel);
+    m_front = previous & INDEX_MASK;
+    return true;
+  }
+
+private:
+  static constexpr std::uint8_t DIRTY = 0x4;
+  static constexpr std::uint8_t INDEX_MASK = 0x3;
+
+  std::array<T, 3> m_buffers;        ///< Storage for the three buffers.
+  std::size_t m_back;                ///< Buffer owned by the writer.
+  std::size_t m_front;               ///< Buffer owned by the reader.
+  std::atomic<std::uint8_t> m_middle; ///< Published buffer and dirty flag.
+};
+} // namespace IO
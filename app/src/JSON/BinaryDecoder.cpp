@@ -0,0 +1,330 @@
+/*
+ * Serial Studio
+ * https://serial-studio.com/
+ *
+ * Copyright (C) 2020–2025 Alex Spataru
+ *
+ * This file is dual-licensed:
+ *
+ * - Under the GNU GPLv3 (or later) for builds that exclude Pro modules.
+ * - Under the Serial Studio Commercial License for builds that include
+ *   any Pro functionality.
+ *
+ * You must comply with the terms of one of these licenses, depending
+ * on your use case.
+ *
+ * For GPL terms, see <https://www.gnu.org/licenses/gpl-3.0.html>
+ * For commercial terms, see LICENSE_COMMERCIAL.md in the project root.
+ *
+ * SPDX-License-Identifier: GPL-3.0-only OR LicenseRef-SerialStudio-Commercial
+ */
+
+#include <cstring>
+
+#include <QMap>
+#include <QDebug>
+#include <QLocale>
+#include <QtEndian>
+
+#include "JSON/BinaryDecoder.h"
+
+//------------------------------------------------------------------------------
+// Field type helpers
+//------------------------------------------------------------------------------
+
+namespace
+{
+/**
+ * @brief Returns the number of bytes used by a field of the given type.
+ */
+qsizetype typeSize(const JSON::BinaryField::Type type)
+{
+  switch (type)
+  {
+    case JSON::BinaryField::Type::U8:
+    case JSON::BinaryField::Type::I8:
+      return 1;
+    case JSON::BinaryField::Type::U16:
+    case JSON::BinaryField::Type::I16:
+      return 2;
+    case JSON::BinaryField::Type::U32:
+    case JSON::BinaryField::Type::I32:
+    case JSON::BinaryField::Type::F32:
+      return 4;
+    case JSON::BinaryField::Type::U64:
+    case JSON::BinaryField::Type::I64:
+    case JSON::BinaryField::Type::F64:
+      return 8;
+  }
+
+  return 0;
+}
+
+/**
+ * @brief Returns @c true for signed integer types.
+ */
+bool isSigned(const JSON::BinaryField::Type type)
+{
+  return type == JSON::BinaryField::Type::I8
+         || type == JSON::BinaryField::Type::I16
+         || type == JSON::BinaryField::Type::I32
+         || type == JSON::BinaryField::Type::I64;
+}
+
+/**
+ * @brief Returns @c true for floating point types.
+ */
+bool isFloat(const JSON::BinaryField::Type type)
+{
+  return type == JSON::BinaryField::Type::F32
+         || type == JSON::BinaryField::Type::F64;
+}
+
+/**
+ * @brief Reads an unsigned integer of type @a T with the given byte order.
+ */
+template<typename T>
+quint64 readBits(const uchar *data, const bool bigEndian)
+{
+  if (bigEndian)
+    return qFromBigEndian<T>(data);
+
+  return qFromLittleEndian<T>(data);
+}
+} // namespace
+
+//------------------------------------------------------------------------------
+// Constructor & layout loading
+//------------------------------------------------------------------------------
+
+/**
+ * @brief Constructs a decoder without any fields.
+ */
+JSON::BinaryDecoder::BinaryDecoder() {}
+
+/**
+ * @brief Removes all fields from the decoder.
+ */
+void JSON::BinaryDecoder::clear()
+{
+  m_fields.clear();
+}
+
+/**
+ * @brief Compiles the binary layout of a project.
+ *
+ * @param layout       The @c binaryLayout array of the project file.
+ * @param invalidField If not null, receives the zero-based index of the first
+ *                     invalid field, or -1 if the layout is valid.
+ * @return @c true if every field is valid, otherwise the decoder is left
+ *         empty and frames are decoded by the JavaScript frame parser.
+ */
+bool JSON::BinaryDecoder::read(const QJsonArray &layout,
+                               qsizetype *invalidField)
+{
+  clear();
+  if (invalidField)
+    *invalidField = -1;
+
+  m_fields.reserve(layout.count());
+  for (qsizetype i = 0; i < layout.count(); ++i)
+  {
+    BinaryField field;
+    if (!readField(layout.at(i).toObject(), field))
+    {
+      qWarning() << "Invalid binary layout field" << i;
+      if (invalidField)
+        *invalidField = i;
+
+      clear();
+      return false;
+    }
+
+    m_fields.append(field);
+  }
+
+  return true;
+}
+
+/**
+ * @brief Returns @c true if the decoder has no fields.
+ */
+bool JSON::BinaryDecoder::isEmpty() const
+{
+  return m_fields.isEmpty();
+}
+
+/**
+ * @brief Returns the number of fields of the layout.
+ */
+qsizetype JSON::BinaryDecoder::fieldCount() const
+{
+  return m_fields.count();
+}
+
+//------------------------------------------------------------------------------
+// Field decoding
+//------------------------------------------------------------------------------
+
+/**
+ * @brief Decodes a single field of a binary frame.
+ *
+ * Integer fields without scaling are formatted as integers, so that 64-bit
+ * values keep all of their digits in the textual value.
+ *
+ * @param field Index of the field within the layout.
+ * @param data  Raw binary frame.
+ * @param value Receives the scaled numeric value.
+ * @param text  Receives the textual representation of @a value.
+ *
+ * @return @c false if the frame is too short to contain the field.
+ */
+bool JSON::BinaryDecoder::decode(const qsizetype field, const QByteArray &data,
+                                 double &value, QString &text) const
+{
+  // Validate that the field is contained in the frame, without computing
+  // byteOffset + size, which could overflow for huge offsets
+  const auto &f = m_fields[field];
+  const qsizetype size = typeSize(f.type);
+  if (size > data.size() || f.byteOffset > data.size() - size) [[unlikely]]
+    return false;
+
+  // Read the raw bits of the field
+  quint64 bits = 0;
+  const auto *p = reinterpret_cast<const uchar *>(data.constData());
+  switch (size)
+  {
+    case 1:
+      bits = p[f.byteOffset];
+      break;
+    case 2:
+      bits = readBits<quint16>(p + f.byteOffset, f.bigEndian);
+      break;
+    case 4:
+      bits = readBits<quint32>(p + f.byteOffset, f.bigEndian);
+      break;
+    default:
+      bits = readBits<quint64>(p + f.byteOffset, f.bigEndian);
+      break;
+  }
+
+  // Obtain the raw value of the field
+  double raw;
+  if (f.type == BinaryField::Type::F32)
+  {
+    float number;
+    const auto word = static_cast<quint32>(bits);
+    std::memcpy(&number, &word, sizeof(number));
+    raw = number;
+  }
+
+  else if (f.type == BinaryField::Type::F64)
+    std::memcpy(&raw, &bits, sizeof(raw));
+
+  else
+  {
+    // Extract bitfields
+    int width = static_cast<int>(size) * 8;
+    if (f.bitCount > 0)
+    {
+      width = f.bitCount;
+      bits >>= f.bitOffset;
+      if (width < 64)
+        bits &= (quint64(1) << width) - 1;
+    }
+
+    // Sign-extend signed integers
+    const bool negative = isSigned(f.type) && ((bits >> (width - 1)) & 1);
+    if (negative && width < 64)
+      bits |= ~quint64(0) << width;
+
+    // Keep all digits of integers that are not scaled
+    if (f.scale == 1 && f.offset == 0)
+    {
+      if (isSigned(f.type))
+      {
+        value = static_cast<double>(static_cast<qint64>(bits));
+        text = QString::number(static_cast<qint64>(bits));
+      }
+
+      else
+      {
+        value = static_cast<double>(bits);
+        text = QString::number(bits);
+      }
+
+      return true;
+    }
+
+    if (isSigned(f.type))
+      raw = static_cast<double>(static_cast<qint64>(bits));
+    else
+      raw = static_cast<double>(bits);
+  }
+
+  // Apply scale & offset
+  value = raw * f.scale + f.offset;
+  text = QString::number(value, 'g', QLocale::FloatingPointShortest);
+  return true;
+}
+
+/**
+ * @brief Reads and validates a single field of the binary layout.
+ *
+ * @param object JSON object that describes the field.
+ * @param field  Receives the field definition.
+ *
+ * @return @c true if the field definition is valid.
+ */
+bool JSON::BinaryDecoder::readField(const QJsonObject &object,
+                                    BinaryField &field)
+{
+  // Obtain the field type
+  static const QMap<QString, BinaryField::Type> types
+      = {{QStringLiteral("u8"), BinaryField::Type::U8},
+         {QStringLiteral("u16"), BinaryField::Type::U16},
+         {QStringLiteral("u32"), BinaryField::Type::U32},
+         {QStringLiteral("u64"), BinaryField::Type::U64},
+         {QStringLiteral("i8"), BinaryField::Type::I8},
+         {QStringLiteral("i16"), BinaryField::Type::I16},
+         {QStringLiteral("i32"), BinaryField::Type::I32},
+         {QStringLiteral("i64"), BinaryField::Type::I64},
+         {QStringLiteral("f32"), BinaryField::Type::F32},
+         {QStringLiteral("f64"), BinaryField::Type::F64}};
+
+  const auto type = object.value(QStringLiteral("type")).toString().toLower();
+  if (!types.contains(type))
+    return false;
+
+  // Obtain the byte order
+  const auto endianness
+      = object.value(QStringLiteral("endianness")).toString().toLower();
+  if (!endianness.isEmpty() && endianness != QStringLiteral("big")
+      && endianness != QStringLiteral("little"))
+    return false;
+
+  // Read field properties
+  field.type = types.value(type);
+  field.bigEndian = endianness == QStringLiteral("big");
+  field.byteOffset = object.value(QStringLiteral("byteOffset")).toInteger(-1);
+  field.bitOffset = object.value(QStringLiteral("bitOffset")).toInt(0);
+  field.bitCount = object.value(QStringLiteral("bitCount")).toInt(0);
+  field.scale = object.value(QStringLiteral("scale")).toDouble(1);
+  field.offset = object.value(QStringLiteral("offset")).toDouble(0);
+
+  // Validate byte offset
+  if (field.byteOffset < 0)
+    return false;
+
+  // Validate bitfields
+  const int bits = static_cast<int>(typeSize(field.type)) * 8;
+  if (field.bitCount < 0 || field.bitOffset < 0)
+    return false;
+  if (field.bitCount == 0 && field.bitOffset != 0)
+    return false;
+  if (field.bitCount > 0
+      && (isFloat(field.type) || field.bitOffset + field.bitCount > bits))
+    return false;
+
+  return true;
+}
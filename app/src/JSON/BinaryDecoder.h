@@ -0,0 +1,112 @@
+/*
+ * Serial Studio
+ * https://serial-studio.com/
+ *
+ * Copyright (C) 2020–2025 Alex Spataru
+ *
+ * This file is dual-licensed:
+ *
+ * - Under the GNU GPLv3 (or later) for builds that exclude Pro modules.
+ * - Under the Serial Studio Commercial License for builds that include
+ *   any Pro functionality.
+ *
+ * You must comply with the terms of one of these licenses, depending
+ * on your use case.
+ *
+ * For GPL terms, see <https://www.gnu.org/licenses/gpl-3.0.html>
+ * For commercial terms, see LICENSE_COMMERCIAL.md in the project root.
+ *
+ * SPDX-License-Identifier: GPL-3.0-only OR LicenseRef-SerialStudio-Commercial
+ */
+
+#pragma once
+
+#include <QString>
+#include <QVector>
+#include <QByteArray>
+#include <QJsonArray>
+#include <QJsonObject>
+
+namespace JSON
+{
+/**
+ * @brief Describes a single field of a fixed-layout binary frame.
+ *
+ * Each field is read from @c byteOffset with the given type and endianness.
+ * Integer fields may be reduced to a bitfield with @c bitOffset and
+ * @c bitCount, and the resulting number is converted to engineering units
+ * with <tt>value = raw * scale + offset</tt>.
+ */
+struct BinaryField
+{
+  /**
+   * @brief Supported field types.
+   */
+  enum class Type
+  {
+    U8,
+    U16,
+    U32,
+    U64,
+    I8,
+    I16,
+    I32,
+    I64,
+    F32,
+    F64
+  };
+
+  Type type;            ///< Storage type of the field
+  qsizetype byteOffset; ///< Position of the first byte within the frame
+  bool bigEndian;       ///< Byte order of multi-byte fields
+  int bitOffset;        ///< First bit of a bitfield (LSB = 0)
+  int bitCount;         ///< Width of a bitfield, 0 to use the whole field
+  double scale;         ///< Multiplier applied to the raw value
+  double offset;        ///< Value added after scaling
+};
+
+/**
+ * @class JSON::BinaryDecoder
+ * @brief Native decoder for fixed-layout binary frames.
+ *
+ * Projects that use the binary decoder method can describe their frames with
+ * a declarative layout (the @c binaryLayout array of the project file)
+ * instead of reassembling the fields in the JavaScript frame parser. Each
+ * entry of the layout describes one field, and the n-th field is assigned to
+ * the datasets with index n + 1:
+ *
+ * @code
+ * "binaryLayout": [
+ *   { "byteOffset": 0, "type": "u16", "endianness": "big" },
+ *   { "byteOffset": 2, "type": "f32", "scale": 0.1, "offset": -40 },
+ *   { "byteOffset": 6, "type": "u8", "bitOffset": 3, "bitCount": 2 }
+ * ]
+ * @endcode
+ *
+ * Supported types are @c u8, @c u16, @c u32, @c u64, @c i8, @c i16, @c i32,
+ * @c i64, @c f32 and @c f64. Multi-byte fields are little-endian unless
+ * @c endianness is set to @c big.
+ */
+class BinaryDecoder
+{
+public:
+  BinaryDecoder();
+
+  void clear();
+  [[nodiscard]] bool read(const QJsonArray &layout,
+                          qsizetype *invalidField = nullptr);
+
+  [[nodiscard]] bool isEmpty() const;
+  [[nodiscard]] qsizetype fieldCount() const;
+
+  [[nodiscard]] bool decode(const qsizetype field, const QByteArray &data,
+                            double &value, QString &text) const;
+
+private:
+  [[nodiscard]] static bool readField(const QJsonObject &object,
+                                      BinaryField &field);
+
+private:
+  QVector<BinaryField> m_fields;
+};
+} // namespace JSON
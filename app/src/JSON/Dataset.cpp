@@ -19,6 +19,8 @@
  * SPDX-License-Identifier: GPL-3.0-only OR LicenseRef-SerialStudio-Commercial
  */
 
+#include <charconv>
+
 #include "JSON/Dataset.h"
 
 /**
@@ -55,6 +57,7 @@ JSON::Dataset::Dataset(const int groupId, const int datasetId)
   , m_log(false)
   , m_graph(false)
   , m_displayInOverview(false)
+  , m_isNumeric(false)
   , m_title("")
   , m_units("")
   , m_widget("")
@@ -65,6 +68,7 @@ JSON::Dataset::Dataset(const int groupId, const int datasetId)
   , m_min(0)
   , m_alarm(0)
   , m_ledHigh(1)
+  , m_numericValue(0)
   , m_fftSamples(256)
   , m_fftSamplingRate(100)
   , m_groupId(groupId)
@@ -171,6 +175,28 @@ bool JSON::Dataset::displayInOverview() const
   return m_displayInOverview;
 }
 
+/**
+ * @return @c true if the current value of this dataset is a number
+ */
+bool JSON::Dataset::isNumeric() const
+{
+  return m_isNumeric;
+}
+
+/**
+ * @brief Returns the current value of this dataset as a number.
+ *
+ * The value is parsed once when it is assigned, consumers that plot or
+ * compare the value should use this function instead of converting value()
+ * on every frame.
+ *
+ * @return The numeric value, or 0 if the value is not a number.
+ */
+double JSON::Dataset::numericValue() const
+{
+  return m_numericValue;
+}
+
 /**
  * @return The title/description of this dataset
  */
@@ -331,6 +357,8 @@ bool JSON::Dataset::read(const QJsonObject &object)
     if (m_value.isEmpty())
       m_value = QStringLiteral("--.--");
 
+    m_isNumeric = parseNumber(m_value, m_numericValue);
+
     m_min = qMin(m_min, m_max);
     m_max = qMax(m_min, m_max);
 
@@ -339,3 +367,168 @@ bool JSON::Dataset::read(const QJsonObject &object)
 
   return false;
 }
+
+//------------------------------------------------------------------------------
+// Value assignment & number parsing
+//------------------------------------------------------------------------------
+
+/**
+ * @brief Assigns a new value to the dataset and parses it as a number.
+ *
+ * @param value The new value/reading of the dataset.
+ */
+void JSON::Dataset::setValue(const QString &value)
+{
+  m_value = value;
+  m_isNumeric = parseNumber(value, m_numericValue);
+}
+
+/**
+ * @brief Assigns a new value to the dataset without parsing it again.
+ *
+ * Used when copying the value of a dataset that has already been parsed.
+ *
+ * @param value        The new value/reading of the dataset.
+ * @param numericValue The numeric representation of @a value.
+ * @param isNumeric    @c true if @a value is a number.
+ */
+void JSON::Dataset::setValue(const QString &value, const double numericValue,
+                             const bool isNumeric)
+{
+  m_value = value;
+  m_isNumeric = isNumeric;
+  m_numericValue = isNumeric ? numericValue : 0;
+}
+
+/**
+ * @brief Assigns a UTF-8 encoded value to the dataset without parsing it.
+ *
+ * ASCII text is widened directly into the storage of the current value, so
+ * no memory is allocated as long as the string is not shared and its capacity
+ * suffices. Other text is decoded with QString::fromUtf8().
+ *
+ * @param utf8         The new value/reading of the dataset, UTF-8 encoded.
+ * @param numericValue The numeric representation of @a utf8.
+ * @param isNumeric    @c true if @a utf8 is a number.
+ */
+void JSON::Dataset::setValue(QByteArrayView utf8, const double numericValue,
+                             const bool isNumeric)
+{
+  // Widen ASCII characters in place, stop at the first non-ASCII byte
+  const qsizetype size = utf8.size();
+  m_value.resize(size);
+  auto *out = m_value.data();
+  qsizetype i = 0;
+  for (; i < size; ++i)
+  {
+    const auto c = static_cast<uchar>(utf8[i]);
+    if (c > 0x7F) [[unlikely]]
+      break;
+
+    out[i] = QChar(c);
+  }
+
+  // Decode multi-byte sequences with Qt
+  if (i < size) [[unlikely]]
+    m_value = QString::fromUtf8(utf8);
+
+  m_isNumeric = isNumeric;
+  m_numericValue = isNumeric ? numericValue : 0;
+}
+
+/**
+ * @brief Parses a UTF-16 string as a floating point number.
+ *
+ * See parseNumber(const char *, qsizetype, double &) for the accepted format.
+ *
+ * @param text  The text to parse.
+ * @param value Receives the parsed number, or 0 on failure.
+ * @return @c true if @a text is a number.
+ */
+bool JSON::Dataset::parseNumber(QStringView text, double &value)
+{
+  // Numbers are pure ASCII, narrow the string on the stack
+  char buffer[64];
+  const auto trimmed = text.trimmed();
+  if (trimmed.size() > qsizetype(sizeof(buffer))) [[unlikely]]
+  {
+    bool ok = false;
+    value = trimmed.toDouble(&ok);
+    return ok;
+  }
+
+  for (qsizetype i = 0; i < trimmed.size(); ++i)
+  {
+    const char16_t c = trimmed[i].unicode();
+    if (c > 0x7F) [[unlikely]]
+    {
+      value = 0;
+      return false;
+    }
+
+    buffer[i] = static_cast<char>(c);
+  }
+
+  return parseNumber(buffer, trimmed.size(), value);
+}
+
+/**
+ * @brief Parses an ASCII/UTF-8 byte sequence as a floating point number.
+ *
+ * The conversion is locale-independent (always uses '.' as the decimal
+ * separator), ignores surrounding whitespace and accepts an optional leading
+ * '+' sign, matching the behavior of QString::toDouble(). It relies on
+ * std::from_chars() where available, which does not allocate memory.
+ *
+ * @param data  Pointer to the first character.
+ * @param size  Number of characters to parse.
+ * @param value Receives the parsed number, or 0 on failure.
+ * @return @c true if the complete (trimmed) input is a number.
+ */
+bool JSON::Dataset::parseNumber(const char *data, qsizetype size,
+                                double &value)
+{
+  // Trim whitespace
+  const auto isSpace = [](const char c) {
+    return c == ' ' || (c >= '\t' && c <= '\r');
+  };
+
+  const char *begin = data;
+  const char *end = data + size;
+  while (begin < end && isSpace(*begin))
+    ++begin;
+  while (end > begin && isSpace(end[-1]))
+    --end;
+
+  // Skip leading '+' sign, not accepted by std::from_chars()
+  if (begin < end && *begin == '+')
+  {
+    ++begin;
+    if (begin < end && *begin == '-')
+    {
+      value = 0;
+      return false;
+    }
+  }
+
+  // Validate that there is something to parse
+  value = 0;
+  if (begin == end)
+    return false;
+
+  // Parse the number
+#if defined(__cpp_lib_to_chars) && __cpp_lib_to_chars >= 201611L
+  const auto result = std::from_chars(begin, end, value);
+  if (result.ec != std::errc() || result.ptr != end)
+  {
+    value = 0;
+    return false;
+  }
+
+  return true;
+#else
+  bool ok = false;
+  value = QByteArray::fromRawData(begin, end - begin).toDouble(&ok);
+  return ok;
+#endif
+}
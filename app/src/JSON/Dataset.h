@@ -23,6 +23,7 @@
 
 #include <QObject>
 #include <QVariant>
+#include <QByteArrayView>
 #include <QJsonObject>
 
 namespace JSON
@@ -87,6 +88,9 @@ public:
   [[nodiscard]] double ledHigh() const;
   [[nodiscard]] bool displayInOverview() const;
 
+  [[nodiscard]] bool isNumeric() const;
+  [[nodiscard]] double numericValue() const;
+
   [[nodiscard]] int xAxisId() const;
   [[nodiscard]] int fftSamples() const;
   [[nodiscard]] int fftSamplingRate() const;
@@ -109,7 +113,15 @@ public:
   void setMax(double max) { m_max = max; }
   void setUniqueId(const quint32 id) { m_uniqueId = id; }
   void setTitle(const QString &title) { m_title = title; }
-  void setValue(const QString &value) { m_value = value; }
+
+  void setValue(const QString &value);
+  void setValue(const QString &value, const double numericValue,
+                const bool isNumeric);
+  void setValue(QByteArrayView utf8, const double numericValue,
+                const bool isNumeric);
+
+  static bool parseNumber(QStringView text, double &value);
+  static bool parseNumber(const char *data, qsizetype size, double &value);
 
 private:
   quint32 m_uniqueId;
@@ -119,6 +131,7 @@ private:
   bool m_log;
   bool m_graph;
   bool m_displayInOverview;
+  bool m_isNumeric;
 
   QString m_title;
   QString m_units;
@@ -132,6 +145,7 @@ private:
   double m_min;
   double m_alarm;
   double m_ledHigh;
+  double m_numericValue;
   int m_fftSamples;
   int m_fftSamplingRate;
 
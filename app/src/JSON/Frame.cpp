@@ -19,6 +19,8 @@
  * SPDX-License-Identifier: GPL-3.0-only OR LicenseRef-SerialStudio-Commercial
  */
 
+#include <algorithm>
+
 #include "JSON/Frame.h"
 #include "SerialStudio.h"
 
@@ -50,7 +52,9 @@ static QVariant SAFE_READ(const QJsonObject &object, const QString &key,
  * Constructor function
  */
 JSON::Frame::Frame()
-  : m_containsCommercialFeatures(false)
+  : m_datasetCount(0)
+  , m_structureHash(0)
+  , m_containsCommercialFeatures(false)
 {
 }
 
@@ -76,12 +80,17 @@ void JSON::Frame::clear()
   m_frameEnd = "";
   m_checksum = "";
   m_frameStart = "";
+  m_datasetCount = 0;
+  m_structureHash = 0;
+  m_binaryDecoder.clear();
   m_containsCommercialFeatures = false;
 
   m_groups.clear();
   m_actions.clear();
+  m_channelSlots.clear();
   m_groups.squeeze();
   m_actions.squeeze();
+  m_channelSlots.squeeze();
 }
 
 /**
@@ -114,48 +123,110 @@ void JSON::Frame::buildUniqueIds()
 }
 
 /**
- * @brief Compares the structural equivalence of two JSON::Frame objects.
+ * @brief Compiles the channel-to-dataset table of the frame.
  *
- * This method checks whether the current frame and the given frame have the
- * same number of groups, and whether each corresponding group has the same
- * group ID and the same number of datasets in the same order, with matching
- * dataset indices.
+ * Generates one ChannelSlot for every dataset with a valid (1-based) index,
+ * sorted by channel. Datasets that share the same index end up next to each
+ * other, which allows frame builders to parse a channel value once and fan it
+ * out to every dataset that displays it.
  *
- * @param other The frame to compare against.
- * @return true if both frames have identical structural layout; false
- * otherwise.
+ * Call this function after the frame structure has been fully initialized.
  */
-bool JSON::Frame::equalsStructure(const JSON::Frame &other) const
+void JSON::Frame::buildChannelSlots()
 {
-  if (groupCount() != other.groupCount())
-    return false;
-
-  const auto &groupsA = groups();
-  const auto &groupsB = other.groups();
-
-  for (int i = 0, gc = groupsA.size(); i < gc; ++i)
+  m_channelSlots.clear();
+  for (int g = 0; g < m_groups.count(); ++g)
   {
-    const auto &g1 = groupsA[i];
-    const auto &g2 = groupsB[i];
+    const auto &datasets = m_groups[g].datasets();
+    for (int d = 0; d < datasets.count(); ++d)
+    {
+      const int index = datasets[d].index();
+      if (index > 0)
+        m_channelSlots.append(ChannelSlot{index - 1, g, d});
+    }
+  }
 
-    if (g1.groupId() != g2.groupId())
-      return false;
+  std::stable_sort(m_channelSlots.begin(), m_channelSlots.end(),
+                   [](const ChannelSlot &a, const ChannelSlot &b) {
+                     return a.channel < b.channel;
+                   });
+}
 
-    const auto &datasetsA = g1.datasets();
-    const auto &datasetsB = g2.datasets();
+/**
+ * @brief Computes the structure fingerprint of the frame.
+ *
+ * The fingerprint is a 64-bit FNV-1a hash of the number of groups, and of the
+ * group ID, dataset count and dataset indices of every group, which are the
+ * properties that define the layout of the dashboard. It allows
+ * equalsStructure() to compare layouts with a single integer comparison,
+ * regardless of the number of datasets in the project.
+ *
+ * The total number of datasets, see datasetCount(), is counted as well.
+ *
+ * Call this function after the frame structure has been fully initialized.
+ */
+void JSON::Frame::buildStructureHash()
+{
+  m_structureHash = computeStructureHash();
 
-    const int dc = datasetsA.size();
-    if (dc != datasetsB.size())
-      return false;
+  m_datasetCount = 0;
+  for (const auto &group : std::as_const(m_groups))
+    m_datasetCount += group.datasetCount();
+}
 
-    for (int j = 0; j < dc; ++j)
+/**
+ * @brief Computes the structure fingerprint of the frame, without storing it.
+ *
+ * @return The fingerprint, or 0 for frames without any group.
+ */
+quint64 JSON::Frame::computeStructureHash() const
+{
+  // Empty frames share the fingerprint of default-constructed frames
+  if (m_groups.isEmpty())
+    return 0;
+
+  // Hash each value byte by byte (FNV-1a)
+  quint64 hash = 0xcbf29ce484222325ULL;
+  const auto combine = [&hash](const quint32 value) {
+    for (int i = 0; i < 4; ++i)
     {
-      if (datasetsA[j].index() != datasetsB[j].index())
-        return false;
+      hash ^= (value >> (i * 8)) & 0xff;
+      hash *= 0x100000001b3ULL;
     }
+  };
+
+  // Hash the layout of the frame
+  combine(m_groups.count());
+  for (const auto &group : std::as_const(m_groups))
+  {
+    combine(group.groupId());
+    combine(group.datasetCount());
+    for (const auto &dataset : group.datasets())
+      combine(dataset.index());
   }
 
-  return true;
+  return hash;
+}
+
+/**
+ * @brief Compares the structural equivalence of two JSON::Frame objects.
+ *
+ * Two frames have the same structure if they have the same number of groups,
+ * and each corresponding group has the same group ID and the same number of
+ * datasets in the same order, with matching dataset indices.
+ *
+ * The comparison is done with the fingerprints computed by
+ * buildStructureHash(), so it runs in constant time. The fingerprint of a
+ * frame with groups whose fingerprint was never built is computed on the fly,
+ * so that it cannot be mistaken for an empty frame.
+ *
+ * @param other The frame to compare against.
+ * @return true if both frames have identical structural layout; false
+ * otherwise.
+ */
+bool JSON::Frame::equalsStructure(const JSON::Frame &other) const
+{
+  return structureHash() == other.structureHash();
 }
 
 /**
@@ -211,6 +282,10 @@ bool JSON::Frame::read(const QJsonObject &object)
     // Read checksum method
     m_checksum = SAFE_READ(object, "checksum", "").toString();
 
+    // Compile the native binary frame layout (if any)
+    const auto layout = object.value(QStringLiteral("binaryLayout")).toArray();
+    (void)m_binaryDecoder.read(layout);
+
     // Convert hex + escape strings (e.g. "0A 0D", or "\\n0D") to raw bytes
     if (isHex)
     {
@@ -246,8 +321,10 @@ bool JSON::Frame::read(const QJsonObject &object)
     // Check if any of the groups contains commercial widgets
     m_containsCommercialFeatures = SerialStudio::commercialCfg(m_groups);
 
-    // Build unique dataset IDs
+    // Build unique dataset IDs, channel table & structure fingerprint
     buildUniqueIds();
+    buildChannelSlots();
+    buildStructureHash();
 
     // Return status
     return groupCount() > 0;
@@ -266,6 +343,15 @@ int JSON::Frame::groupCount() const
   return static_cast<int>(m_groups.size());
 }
 
+/**
+ * Returns the number of datasets of all groups, counted when the structure
+ * fingerprint is built, see buildStructureHash().
+ */
+int JSON::Frame::datasetCount() const
+{
+  return m_datasetCount;
+}
+
 /**
  * Returns @c true if the frame contains features that should only be enabled
  * for commercial users with a valid license, such as the 3D plot widget.
@@ -307,6 +393,27 @@ const QByteArray &JSON::Frame::frameStart() const
   return m_frameStart;
 }
 
+/**
+ * Returns the native decoder compiled from the binary layout of the project,
+ * which is empty if the project does not define one.
+ */
+const JSON::BinaryDecoder &JSON::Frame::binaryDecoder() const
+{
+  return m_binaryDecoder;
+}
+
+/**
+ * Returns the structure fingerprint of the frame, which only changes when
+ * groups or datasets are added, removed, reordered or re-indexed.
+ */
+quint64 JSON::Frame::structureHash() const
+{
+  if (m_structureHash == 0 && !m_groups.isEmpty()) [[unlikely]]
+    return computeStructureHash();
+
+  return m_structureHash;
+}
+
 /**
  * Returns a vector of pointers to the @c Group objects associated to this
  * frame.
@@ -324,3 +431,102 @@ const QVector<JSON::Action> &JSON::Frame::actions() const
 {
   return m_actions;
 }
+
+/**
+ * Returns the compiled channel-to-dataset table of this frame, sorted by
+ * channel index.
+ */
+const QVector<JSON::ChannelSlot> &JSON::Frame::channelSlots() const
+{
+  return m_channelSlots;
+}
+
+//------------------------------------------------------------------------------
+// Frame records
+//------------------------------------------------------------------------------
+
+/**
+ * @brief Returns @c true if the record refers to a valid frame structure.
+ */
+bool JSON::FrameRecord::isValid() const
+{
+  return structure && structure->isValid();
+}
+
+/**
+ * @brief Creates a standalone copy of the frame structure with the values of
+ *        this record.
+ *
+ * Intended for consumers that need a complete frame from time to time, such
+ * as serializers, since it detaches the shared structure.
+ */
+JSON::Frame JSON::FrameRecord::toFrame() const
+{
+  if (!structure) [[unlikely]]
+    return Frame();
+
+  Frame frame = *structure;
+  applyTo(frame);
+  return frame;
+}
+
+/**
+ * @brief Assigns the values of this record to the datasets of @a frame.
+ *
+ * @a frame is expected to have the same structure that was used to capture
+ * the record. Datasets that have no matching value keep their current value.
+ *
+ * @param frame The frame to update.
+ */
+void JSON::FrameRecord::applyTo(Frame &frame) const
+{
+  qsizetype i = 0;
+  const qsizetype count = values.size();
+  for (auto &group : frame.m_groups)
+  {
+    for (auto &dataset : group.m_datasets)
+    {
+      if (i >= count) [[unlikely]]
+        return;
+
+      const auto &v = values[i++];
+      dataset.setValue(v.value, v.numericValue, v.isNumeric);
+    }
+  }
+}
+
+/**
+ * @brief Captures the dataset values of @a frame into a new record.
+ *
+ * The frame structure is only copied when it differs from @a structure, in
+ * which case @a structure is updated to point to the new copy, so that
+ * consecutive records with the same layout share it. Reset @a structure to
+ * force a new copy after changing titles or other non-structural properties.
+ *
+ * @param frame      The frame with the latest dataset values.
+ * @param structure  Shared structure cache of the caller.
+ * @param rxDateTime Time at which the frame was received.
+ *
+ * @return The record with the dataset values of @a frame.
+ */
+JSON::FrameRecord
+JSON::FrameRecord::capture(const Frame &frame,
+                           std::shared_ptr<const Frame> &structure,
+                           const QDateTime &rxDateTime)
+{
+  if (!structure || !structure->equalsStructure(frame)) [[unlikely]]
+    structure = std::make_shared<const Frame>(frame);
+
+  FrameRecord record;
+  record.structure = structure;
+  record.rxDateTime = rxDateTime;
+  record.values.reserve(structure->datasetCount());
+  for (const auto &group : frame.groups())
+  {
+    for (const auto &dataset : group.datasets())
+      record.values.append(DatasetValue{dataset.value(), dataset.numericValue(),
+                                        dataset.isNumeric()});
+  }
+
+  return record;
+}
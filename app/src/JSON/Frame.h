@@ -21,7 +21,10 @@
 
 #pragma once
 
+#include <memory>
+
 #include <QVector>
+#include <QDateTime>
 #include <QObject>
 #include <QVariant>
 #include <QJsonArray>
@@ -29,9 +32,24 @@
 
 #include "JSON/Group.h"
 #include "JSON/Action.h"
+#include "JSON/BinaryDecoder.h"
 
 namespace JSON
 {
+/**
+ * @brief Location of a dataset that receives the value of a frame channel.
+ *
+ * Channel slots are compiled once when the frame structure is built, so that
+ * incoming channel values can be assigned with a single linear pass instead
+ * of walking every group and dataset of the frame.
+ */
+struct ChannelSlot
+{
+  int channel; ///< Zero-based index of the channel in the parsed frame
+  int group;   ///< Index of the group within the frame
+  int dataset; ///< Index of the dataset within its group
+};
+
 /**
  * @brief The Frame class
  *
@@ -54,6 +72,7 @@ namespace JSON
  * class.
  */
 class FrameBuilder;
+struct FrameRecord;
 class Frame
 {
 public:
@@ -62,6 +81,8 @@ public:
 
   void clear();
   void buildUniqueIds();
+  void buildChannelSlots();
+  void buildStructureHash();
 
   [[nodiscard]] bool isValid() const;
   [[nodiscard]] bool equalsStructure(const JSON::Frame &other) const;
@@ -70,28 +91,76 @@ public:
   [[nodiscard]] bool read(const QJsonObject &object);
 
   [[nodiscard]] int groupCount() const;
+  [[nodiscard]] int datasetCount() const;
+  [[nodiscard]] quint64 structureHash() const;
   [[nodiscard]] bool containsCommercialFeatures() const;
 
   [[nodiscard]] const QString &title() const;
   [[nodiscard]] const QString &checksum() const;
   [[nodiscard]] const QByteArray &frameEnd() const;
   [[nodiscard]] const QByteArray &frameStart() const;
+  [[nodiscard]] const BinaryDecoder &binaryDecoder() const;
 
   [[nodiscard]] const QVector<Group> &groups() const;
   [[nodiscard]] const QVector<Action> &actions() const;
+  [[nodiscard]] const QVector<ChannelSlot> &channelSlots() const;
+
+private:
+  [[nodiscard]] quint64 computeStructureHash() const;
 
 private:
   QString m_title;
   QString m_checksum;
   QByteArray m_frameEnd;
   QByteArray m_frameStart;
+  BinaryDecoder m_binaryDecoder;
 
   QVector<Group> m_groups;
   QVector<Action> m_actions;
+  QVector<ChannelSlot> m_channelSlots;
 
+  int m_datasetCount;
+  quint64 m_structureHash;
   bool m_containsCommercialFeatures;
 
   friend class UI::Dashboard;
   friend class JSON::FrameBuilder;
+  friend struct JSON::FrameRecord;
+};
+
+/**
+ * @brief Value of a single dataset within a FrameRecord.
+ */
+struct DatasetValue
+{
+  QString value;           ///< Textual value, as received
+  double numericValue = 0; ///< Parsed numeric value (0 if not numeric)
+  bool isNumeric = false;  ///< Whether the value could be parsed as a number
+};
+
+/**
+ * @brief Compact record of the dataset values of a single frame.
+ *
+ * The structure of a frame (titles, units, widgets, ranges, etc.) rarely
+ * changes, so records share a single immutable copy of it and only carry the
+ * values of the datasets, in the order in which they appear in the frame,
+ * together with the time at which the frame was received.
+ *
+ * Copying a record only increments reference counts, which makes it cheap to
+ * queue records for consumers that run in other threads.
+ */
+struct FrameRecord
+{
+  std::shared_ptr<const Frame> structure; ///< Shared frame structure
+  QVector<DatasetValue> values;           ///< Dataset values in frame order
+  QDateTime rxDateTime;                   ///< Time at which frame was received
+
+  [[nodiscard]] bool isValid() const;
+  [[nodiscard]] Frame toFrame() const;
+  void applyTo(Frame &frame) const;
+
+  [[nodiscard]] static FrameRecord
+  capture(const Frame &frame, std::shared_ptr<const Frame> &structure,
+          const QDateTime &rxDateTime);
 };
 } // namespace JSON
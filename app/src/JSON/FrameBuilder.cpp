@@ -19,7 +19,12 @@
  * SPDX-License-Identifier: GPL-3.0-only OR LicenseRef-SerialStudio-Commercial
  */
 
+#include <cstring>
+
 #include <QFileInfo>
+#include <QApplication>
+#include <QDeadlineTimer>
+#include <QCryptographicHash>
 
 #include "IO/Manager.h"
 #include "Misc/Utilities.h"
@@ -38,13 +43,51 @@
 #include "UI/Dashboard.h"
 #include "Plugins/Server.h"
 
+/**
+ * Number of frames recorded per session to warm up the frame parser code
+ */
+constexpr int MAX_WARMUP_SAMPLES = 16;
+
+/**
+ * Maximum number of bytes of recorded frames stored per project for warm-up
+ */
+constexpr qsizetype MAX_WARMUP_BYTES = 16 * 1024;
+
+/**
+ * Maximum time that the GUI thread waits for the frame parsing thread to
+ * publish its pending frames before the pipeline is stopped
+ */
+constexpr qint64 PIPELINE_FLUSH_TIMEOUT_MS = 1000;
+
+/**
+ * Maximum time that the GUI thread sleeps while flushing the pipeline before
+ * it publishes the snapshots produced in the meantime
+ */
+constexpr qint64 PIPELINE_FLUSH_WAIT_MS = 10;
+
+/**
+ * Returns the settings key under which the warm-up frames of the project
+ * stored at @a path are saved
+ */
+static QString warmupKey(const QString &path)
+{
+  const auto hash
+      = QCryptographicHash::hash(path.toUtf8(), QCryptographicHash::Sha1);
+  return QStringLiteral("parserWarmup/%1").arg(hash.toHex());
+}
+
 /**
  * Initializes the JSON Parser class and connects appropiate SIGNALS/SLOTS
  */
 JSON::FrameBuilder::FrameBuilder()
   : m_quickPlotChannels(-1)
+  , m_threadedFrameParsing(false)
+  , m_parserThreads(1)
   , m_frameParser(nullptr)
   , m_opMode(SerialStudio::ProjectFile)
+  , m_parserPool(nullptr)
+  , m_scriptParser(nullptr)
+  , m_pipelineFramesDropped(0)
 {
   // Read JSON map location
   auto path = m_settings.value("json_map_location", "").toString();
@@ -55,6 +98,15 @@ JSON::FrameBuilder::FrameBuilder()
   auto m = m_settings.value("operation_mode", SerialStudio::QuickPlot).toInt();
   setOperationMode(static_cast<SerialStudio::OperationMode>(m));
 
+  // Obtain frame parsing thread settings
+  m_threadedFrameParsing
+      = m_settings.value("threadedFrameParsing", false).toBool();
+  m_parserThreads = qBound(
+      1, m_settings.value("parserThreads", maxParserThreads()).toInt(),
+      maxParserThreads());
+  connect(qApp, &QApplication::aboutToQuit, this,
+          &JSON::FrameBuilder::stopPipelineThread);
+
   // Reload JSON map file when license is activated
 #ifdef BUILD_COMMERCIAL
   connect(&Licensing::LemonSqueezy::instance(),
@@ -65,6 +117,14 @@ JSON::FrameBuilder::FrameBuilder()
 #endif
 }
 
+/**
+ * Stops the frame parsing thread (if running)
+ */
+JSON::FrameBuilder::~FrameBuilder()
+{
+  stopPipelineThread();
+}
+
 /**
  * Returns the only instance of the class
  */
@@ -124,6 +184,108 @@ JSON::FrameParser *JSON::FrameBuilder::frameParser() const
   return m_frameParser;
 }
 
+/**
+ * Returns @c true if frames are parsed in a separate thread while a device is
+ * connected.
+ */
+bool JSON::FrameBuilder::threadedFrameParsing() const
+{
+  return m_threadedFrameParsing;
+}
+
+/**
+ * Returns the maximum number of threads that run the frame parser code of
+ * stateless projects at once (only while threaded frame parsing is active).
+ */
+int JSON::FrameBuilder::parserThreads() const
+{
+  return m_parserThreads;
+}
+
+/**
+ * Returns the largest number of frame parser threads that can be selected.
+ */
+int JSON::FrameBuilder::maxParserThreads() const
+{
+  return ParserPool::idealWorkerCount();
+}
+
+/**
+ * @brief Returns the number of parsed frames that were lost during the
+ *        current session because the GUI thread did not publish them in time.
+ */
+quint64 JSON::FrameBuilder::framesDropped() const
+{
+  auto dropped = m_pipelineFramesDropped;
+  if (m_pipeline)
+    dropped += m_pipeline->framesDropped();
+
+  return dropped;
+}
+
+/**
+ * @brief Returns sample frames used to warm up the frame parser code.
+ *
+ * The frames are the first ones received during the last session with the
+ * current project, if its frame parser code and decoder did not change since
+ * then. If none were recorded, synthetic
+ * frames are generated from the number of datasets in the project: a comma
+ * separated list of numbers for plain text projects, a sequence of bytes
+ * otherwise.
+ *
+ * Warm-up calls the @c parse() function before the device sends any data, so
+ * a parser that keeps state between calls would start with corrupted state.
+ * No samples are returned unless the project declares its frame parser as
+ * stateless.
+ */
+QList<QByteArray> JSON::FrameBuilder::warmupSamples() const
+{
+  // Only stateless parsers may be warmed up
+  const auto &project = JSON::ProjectModel::instance();
+  if (!project.statelessParser())
+    return {};
+
+  // Obtain recorded frames for the current project & parser code
+  const auto decoder = project.decoderMethod();
+  const auto hash
+      = ScriptParser::scriptHash(project.frameParserCode(), decoder);
+  const auto entry = m_settings.value(warmupKey(jsonMapFilepath())).toMap();
+
+  QList<QByteArray> samples;
+  if (entry.value(QStringLiteral("script")).toByteArray() == hash)
+  {
+    const auto recorded = entry.value(QStringLiteral("frames")).toList();
+    for (const auto &frame : recorded)
+      samples.append(frame.toByteArray());
+  }
+
+  if (!samples.isEmpty())
+    return samples;
+
+  // Generate a synthetic frame with one value per dataset
+  int datasets = 0;
+  for (const auto &group : m_frame.groups())
+    datasets += group.datasets().count();
+
+  QByteArray frame;
+  for (int i = 0; i < qMax(1, datasets); ++i)
+  {
+    if (decoder == SerialStudio::PlainText)
+    {
+      if (i > 0)
+        frame.append(',');
+
+      frame.append(QByteArray::number(i));
+    }
+
+    else
+      frame.append(static_cast<char>(i));
+  }
+
+  samples.append(frame);
+  return samples;
+}
+
 /**
  * Returns the operation mode
  */
@@ -140,6 +302,34 @@ void JSON::FrameBuilder::setupExternalConnections()
 {
   connect(&IO::Manager::instance(), &IO::Manager::connectedChanged, this,
           &JSON::FrameBuilder::onConnectedChanged);
+
+  // Keep the parsing pipeline in sync with the project configuration, which
+  // only changes when a project is loaded or saved and when the frame parser
+  // code is applied, not on every edit in the project editor
+  connect(this, &JSON::FrameBuilder::jsonFileMapChanged, this,
+          &JSON::FrameBuilder::configurePipeline);
+  connect(this, &JSON::FrameBuilder::operationModeChanged, this,
+          &JSON::FrameBuilder::configurePipeline);
+  connect(&JSON::ProjectModel::instance(),
+          &JSON::ProjectModel::frameParserCodeChanged, this,
+          &JSON::FrameBuilder::configurePipeline);
+
+  // Apply the frame queue policy to the snapshot queue of the pipeline
+  connect(&IO::Manager::instance(), &IO::Manager::queuePolicyChanged, this,
+          [=, this] {
+            QPointer<FramePipeline> pipeline = m_pipeline;
+            if (!pipeline)
+              return;
+
+            const auto policy = IO::Manager::instance().queuePolicy();
+            QMetaObject::invokeMethod(
+                pipeline,
+                [pipeline, policy] {
+                  if (pipeline)
+                    pipeline->setQueuePolicy(policy);
+                },
+                Qt::QueuedConnection);
+          });
 }
 
 /**
@@ -184,6 +374,7 @@ void JSON::FrameBuilder::loadJsonMap(const QString &path)
 
       // Load frame from data
       m_frame.clear();
+      m_recordStructure.reset();
       const bool ok = m_frame.read(document.object());
 
       // Update I/O manager settings
@@ -239,6 +430,51 @@ void JSON::FrameBuilder::setFrameParser(JSON::FrameParser *parser)
   m_frameParser = parser;
 }
 
+/**
+ * @brief Enables or disables parsing frames in a separate thread.
+ *
+ * Can only be changed while no device is connected, the setting takes effect
+ * with the next connection.
+ *
+ * @param enabled Set to @c true to parse frames outside the GUI thread.
+ */
+void JSON::FrameBuilder::setThreadedFrameParsing(const bool enabled)
+{
+  if (!IO::Manager::instance().isConnected())
+  {
+    m_threadedFrameParsing = enabled;
+    m_settings.setValue("threadedFrameParsing", enabled);
+    if (!enabled)
+      stopPipelineThread();
+
+    Q_EMIT threadedFrameParsingChanged();
+  }
+}
+
+/**
+ * @brief Limits the number of threads that run the frame parser code.
+ *
+ * Frames of projects with a stateless frame parser are distributed among a
+ * pool of JavaScript engines and reordered before they are published.
+ * Whether a parser is stateless is a property of the project, this setting
+ * only caps the size of the pool. Requires threaded frame parsing.
+ *
+ * Can only be changed while no device is connected, the setting takes effect
+ * with the next connection.
+ *
+ * @param threads Maximum number of parser threads, @c 1 disables the pool.
+ */
+void JSON::FrameBuilder::setParserThreads(const int threads)
+{
+  if (!IO::Manager::instance().isConnected())
+  {
+    m_parserThreads = qBound(1, threads, maxParserThreads());
+    m_settings.setValue("parserThreads", m_parserThreads);
+
+    Q_EMIT parserThreadsChanged();
+  }
+}
+
 /**
  * Changes the operation mode of the JSON parser. There are two possible op.
  * modes:
@@ -279,6 +515,8 @@ void JSON::FrameBuilder::setOperationMode(
       break;
   }
 
+  m_jsonReader.reset();
+  m_recordStructure.reset();
   m_settings.setValue("operation_mode", mode);
   Q_EMIT operationModeChanged();
 }
@@ -294,7 +532,8 @@ void JSON::FrameBuilder::setOperationMode(
  * This is a hotpath function executed at high frequency.
  *
  * It routes the incoming binary data to the correct parsing strategy:
- * - If the device sends JSON directly, parses it using QJsonDocument.
+ * - If the device sends JSON directly, parses it using JSON::StreamReader,
+ *   which only updates the dataset values while the frame shape is stable.
  * - If using a project file, delegates parsing to the configured frame parser.
  * - If in Quick Plot mode, parses CSV-like data for plotting.
  *
@@ -302,6 +541,19 @@ void JSON::FrameBuilder::setOperationMode(
  */
 void JSON::FrameBuilder::hotpathRxFrame(const QByteArray &data)
 {
+  if (m_pipeline && !CSV::Player::instance().isOpen())
+  {
+    hotpathRxFrames(QList<QByteArray>{data});
+    return;
+  }
+
+  // Record the first frames of the session to warm up the parser next time
+  if (m_recordedFrames.count() < MAX_WARMUP_SAMPLES) [[unlikely]]
+  {
+    if (!CSV::Player::instance().isOpen())
+      m_recordedFrames.append(data);
+  }
+
   switch (operationMode())
   {
     case SerialStudio::QuickPlot:
@@ -311,12 +563,158 @@ void JSON::FrameBuilder::hotpathRxFrame(const QByteArray &data)
       parseProjectFrame(data);
       break;
     case SerialStudio::DeviceSendsJSON:
-      if (m_rawFrame.read(QJsonDocument::fromJson(data).object()))
+      if (m_jsonReader.read(data, m_rawFrame))
+      {
+        if (m_jsonReader.rebuilt()) [[unlikely]]
+          m_recordStructure.reset();
+
+        hotpathTxFrame(m_rawFrame);
+      }
+      break;
+  }
+}
+
+/**
+ * @brief Dispatches a batch of raw frames to the frame parser.
+ *
+ * Equivalent to calling hotpathRxFrame() for every frame, but resolves the
+ * operation mode once per batch. Used by IO::Manager, which drains all frames
+ * queued by the frame reader with a single wakeup.
+ *
+ * If threaded frame parsing is active, the batch is handed over to the
+ * pipeline thread instead, and the parsed frames are published later by
+ * hotpathPublishSnapshots().
+ *
+ * @param frames Raw frames, in the order in which they were received.
+ */
+void JSON::FrameBuilder::hotpathRxFrames(const QList<QByteArray> &frames)
+{
+  // Record the first frames of the session to warm up the parser next time
+  if (m_recordedFrames.count() < MAX_WARMUP_SAMPLES) [[unlikely]]
+  {
+    const auto count = MAX_WARMUP_SAMPLES - m_recordedFrames.count();
+    if (!CSV::Player::instance().isOpen())
+      m_recordedFrames.append(frames.mid(0, count));
+  }
+
+  // Parse frames in the pipeline thread
+  if (m_pipeline && !CSV::Player::instance().isOpen())
+  {
+    QPointer<FramePipeline> pipeline = m_pipeline;
+    const auto rxDateTime = QDateTime::currentDateTime();
+    QMetaObject::invokeMethod(
+        pipeline,
+        [pipeline, frames, rxDateTime] {
+          if (pipeline)
+            pipeline->processFrames(frames, rxDateTime);
+        },
+        Qt::QueuedConnection);
+
+    return;
+  }
+
+  // Parse frames in the calling thread
+  switch (operationMode())
+  {
+    case SerialStudio::QuickPlot:
+      for (const auto &data : frames)
+        parseQuickPlotFrame(data);
+      break;
+    case SerialStudio::ProjectFile:
+      for (const auto &data : frames)
+        parseProjectFrame(data);
+      break;
+    case SerialStudio::DeviceSendsJSON:
+      for (const auto &data : frames)
+      {
+        if (!m_jsonReader.read(data, m_rawFrame))
+          continue;
+
+        if (m_jsonReader.rebuilt()) [[unlikely]]
+          m_recordStructure.reset();
+
         hotpathTxFrame(m_rawFrame);
+      }
       break;
   }
 }
 
+/**
+ * @brief Publishes all frames parsed by the pipeline thread.
+ *
+ * Called by the dashboard at its 24 Hz update tick. Every snapshot produced
+ * since the previous tick is forwarded in a single pass, so that plots and
+ * CSV exports still receive every sample, while the GUI thread only performs
+ * the work required to display the data.
+ */
+void JSON::FrameBuilder::hotpathPublishSnapshots()
+{
+  auto pipeline = m_pipeline;
+  if (!pipeline)
+    return;
+
+  while (pipeline->takeSnapshot(m_snapshot))
+  {
+    if (m_snapshot.structure != m_snapshotStructure) [[unlikely]]
+    {
+      m_snapshotStructure = m_snapshot.structure;
+      m_snapshotFrame = *m_snapshotStructure;
+    }
+
+    m_snapshot.applyTo(m_snapshotFrame);
+    hotpathTxFrame(m_snapshotFrame, m_snapshot);
+  }
+
+  m_snapshot = JSON::FrameRecord();
+}
+
+/**
+ * @brief Publishes every frame that was handed to the pipeline thread.
+ *
+ * Sleeps on a wait condition that FramePipeline::finish() signals once the
+ * pipeline has parsed all queued batches (including frames that are still
+ * being parsed by the parser pool). The wait is split into slices of at most
+ * PIPELINE_FLUSH_WAIT_MS, between which snapshots are published so that the
+ * pipeline never waits for a full snapshot queue. Gives up after
+ * PIPELINE_FLUSH_TIMEOUT_MS, e.g. if the parser code hangs.
+ *
+ * Called before the pipeline is stopped and before a device is disconnected,
+ * so that the last frames of a session reach every output module.
+ */
+void JSON::FrameBuilder::flushPipeline()
+{
+  QPointer<FramePipeline> pipeline = m_pipeline;
+  if (!pipeline || !m_pipelineThread.isRunning())
+    return;
+
+  // Ask the pipeline thread to report when every queued frame is published
+  auto state = std::make_shared<JSON::FlushState>();
+  QMetaObject::invokeMethod(
+      pipeline,
+      [pipeline, state] {
+        if (pipeline)
+          pipeline->finish(state);
+      },
+      Qt::QueuedConnection);
+
+  // Sleep until the pipeline is done, draining the snapshots between waits
+  QDeadlineTimer deadline(PIPELINE_FLUSH_TIMEOUT_MS);
+  while (true)
+  {
+    hotpathPublishSnapshots();
+
+    QMutexLocker locker(&state->mutex);
+    if (state->done || deadline.hasExpired())
+      break;
+
+    const auto slice = std::min(deadline.remainingTime(),
+                                PIPELINE_FLUSH_WAIT_MS);
+    state->condition.wait(&state->mutex, QDeadlineTimer(slice));
+  }
+
+  hotpathPublishSnapshots();
+}
+
 //------------------------------------------------------------------------------
 // Private slots
 //------------------------------------------------------------------------------
@@ -338,8 +736,22 @@ void JSON::FrameBuilder::hotpathRxFrame(const QByteArray &data)
  */
 void JSON::FrameBuilder::onConnectedChanged()
 {
-  // Reset quick plot field count
+  // Reset quick plot field count & read the settings of the input source
   m_quickPlotChannels = -1;
+  m_quickPlotSource = quickPlotSource();
+
+  // Store the frames recorded during the last session
+  saveWarmupSamples();
+
+  // Reset the frame loss statistics of the new session
+  if (IO::Manager::instance().isConnected())
+    m_pipelineFramesDropped = 0;
+
+  // Start or stop the frame parsing thread
+  if (IO::Manager::instance().isConnected() && m_threadedFrameParsing)
+    startPipeline();
+  else
+    stopPipeline();
 
   // Validate that the device is connected
   if (!IO::Manager::instance().isConnected())
@@ -358,6 +770,176 @@ void JSON::FrameBuilder::onConnectedChanged()
   }
 }
 
+/**
+ * @brief Sends the current project configuration to the parsing pipeline.
+ *
+ * The pipeline keeps private copies of the project frame structure and of
+ * the frame parser code, since it cannot access GUI thread objects.
+ */
+void JSON::FrameBuilder::configurePipeline()
+{
+  QPointer<FramePipeline> pipeline = m_pipeline;
+  if (!pipeline)
+    return;
+
+  const auto frame = m_frame;
+  const auto mode = m_opMode;
+  const auto &project = JSON::ProjectModel::instance();
+  const auto script = project.frameParserCode();
+  const auto decoder = project.decoderMethod();
+  const auto samples = warmupSamples();
+  const auto quickPlot = m_quickPlotSource;
+  const auto stateless = project.statelessParser();
+  const auto threads = stateless ? m_parserThreads : 1;
+  QMetaObject::invokeMethod(
+      pipeline,
+      [pipeline, frame, script, mode, decoder, stateless, threads, samples,
+       quickPlot] {
+        if (pipeline)
+          pipeline->configure(frame, script, mode, decoder, stateless, threads,
+                              samples, quickPlot);
+      },
+      Qt::QueuedConnection);
+}
+
+//------------------------------------------------------------------------------
+// Frame parsing thread management
+//------------------------------------------------------------------------------
+
+/**
+ * @brief Creates the frame pipeline and starts its worker thread.
+ *
+ * The script parser and the parser pool are created together with the
+ * thread and kept until it is stopped, so the engines loaded by a session
+ * are still warm when the device reconnects. They only reuse an engine if
+ * the project code is stateless & its script hash did not change.
+ *
+ * Does nothing if the pipeline is already running.
+ */
+void JSON::FrameBuilder::startPipeline()
+{
+  if (m_pipeline)
+    return;
+
+  if (!m_pipelineThread.isRunning())
+  {
+    m_parserPool = new ParserPool();
+    m_scriptParser = new ScriptParser();
+    m_parserPool->moveToThread(&m_pipelineThread);
+    m_scriptParser->moveToThread(&m_pipelineThread);
+    connect(&m_pipelineThread, &QThread::finished, m_parserPool,
+            &QObject::deleteLater);
+    connect(&m_pipelineThread, &QThread::finished, m_scriptParser,
+            &QObject::deleteLater);
+    m_pipelineThread.start();
+  }
+
+  m_pipeline = new FramePipeline(m_scriptParser, m_parserPool);
+  m_pipeline->setQueuePolicy(IO::Manager::instance().queuePolicy());
+  m_pipeline->moveToThread(&m_pipelineThread);
+
+  configurePipeline();
+}
+
+/**
+ * @brief Destroys the frame pipeline, keeping its worker thread running.
+ *
+ * Frames that were handed to the pipeline are parsed and published first.
+ */
+void JSON::FrameBuilder::stopPipeline()
+{
+  flushPipeline();
+  if (m_pipeline)
+  {
+    m_pipelineFramesDropped += m_pipeline->framesDropped();
+    QMetaObject::invokeMethod(m_pipeline, &QObject::deleteLater,
+                              Qt::QueuedConnection);
+    m_pipeline.clear();
+  }
+
+  m_snapshotFrame.clear();
+  m_snapshotStructure.reset();
+}
+
+/**
+ * @brief Destroys the frame pipeline, stops its worker thread & releases the
+ *        JavaScript engines kept for the next session.
+ */
+void JSON::FrameBuilder::stopPipelineThread()
+{
+  stopPipeline();
+  if (m_pipelineThread.isRunning())
+  {
+    m_pipelineThread.quit();
+    m_pipelineThread.wait();
+  }
+
+  m_parserPool = nullptr;
+  m_scriptParser = nullptr;
+}
+
+/**
+ * @brief Stores the frames recorded during the last session for warm-up.
+ *
+ * A single entry is kept per project file, together with the hash of the
+ * frame parser code & decoder it was recorded with, so reopening a project
+ * warms up its parser with frames sent by the actual device. Frames are
+ * stored until MAX_WARMUP_BYTES are reached, and entries of project files
+ * that no longer exist are removed.
+ *
+ * Only project mode sessions of stateless parsers are stored, since other
+ * sessions never warm up any parser code.
+ */
+void JSON::FrameBuilder::saveWarmupSamples()
+{
+  const auto path = jsonMapFilepath();
+  if (m_opMode == SerialStudio::ProjectFile
+      && JSON::ProjectModel::instance().statelessParser()
+      && !path.isEmpty() && !m_recordedFrames.isEmpty()
+      && !CSV::Player::instance().isOpen())
+  {
+    const auto &project = JSON::ProjectModel::instance();
+    const auto hash = ScriptParser::scriptHash(project.frameParserCode(),
+                                               project.decoderMethod());
+
+    // Keep the recorded frames that fit in the storage limit
+    qsizetype bytes = 0;
+    QVariantList frames;
+    for (const auto &frame : std::as_const(m_recordedFrames))
+    {
+      if (bytes + frame.size() > MAX_WARMUP_BYTES)
+        continue;
+
+      bytes += frame.size();
+      frames.append(frame);
+    }
+
+    // Remove entries of deleted projects & entries in the old format
+    m_settings.beginGroup(QStringLiteral("parserWarmup"));
+    const auto keys = m_settings.childKeys();
+    for (const auto &key : keys)
+    {
+      const auto entry = m_settings.value(key).toMap();
+      const auto file = entry.value(QStringLiteral("path")).toString();
+      if (file.isEmpty() || !QFileInfo::exists(file))
+        m_settings.remove(key);
+    }
+    m_settings.endGroup();
+
+    // Replace the entry of the project
+    if (!frames.isEmpty())
+    {
+      QVariantMap entry;
+      entry.insert(QStringLiteral("path"), path);
+      entry.insert(QStringLiteral("script"), hash);
+      entry.insert(QStringLiteral("frames"), frames);
+      m_settings.setValue(warmupKey(path), entry);
+    }
+  }
+
+  m_recordedFrames.clear();
+}
+
 /**
  * Saves the location of the last valid JSON map file that was opened (if any)
  */
@@ -375,9 +957,10 @@ void JSON::FrameBuilder::setJsonPathSetting(const QString &path)
  *
  * Converts incoming binary data into structured field values based on the
  * decoder method defined in the project model (e.g., plain text, hex, base64,
- * binary). If CSV playback is active, skips decoding and parses the simplified
- * string directly. Updates all frame datasets with the parsed values and
- * triggers a UI update.
+ * binary). Binary frames of projects that define a binary layout are decoded
+ * natively, without calling the JavaScript frame parser. If CSV playback is
+ * active, skips decoding and parses the simplified string directly. Updates
+ * all frame datasets with the parsed values and triggers a UI update.
  *
  * @param data Raw binary input to be decoded and assigned to frame datasets.
  *
@@ -385,48 +968,108 @@ void JSON::FrameBuilder::setJsonPathSetting(const QString &path)
  */
 void JSON::FrameBuilder::parseProjectFrame(const QByteArray &data)
 {
+  // Decode fixed-layout binary frames natively
+  const auto decoder = JSON::ProjectModel::instance().decoderMethod();
+  if (!CSV::Player::instance().isOpen() && decoder == SerialStudio::Binary
+      && !m_frame.binaryDecoder().isEmpty())
+  {
+    updateBinaryFrame(m_frame, data);
+    hotpathTxFrame(m_frame);
+    return;
+  }
+
   // Real-time data, parse data & perform conversion
-  QStringList channels;
+  QVector<JSON::DatasetValue> channels;
   if (!CSV::Player::instance().isOpen() && m_frameParser) [[likely]]
+    channels = m_frameParser->parse(data, decoder);
+
+  // CSV data, no need to perform conversions or use frame parser
+  else
   {
-    switch (JSON::ProjectModel::instance().decoderMethod())
+    const auto values = QString::fromUtf8(data).split(',', Qt::SkipEmptyParts);
+    channels.resize(values.count());
+    for (int i = 0; i < values.count(); ++i)
     {
-      case SerialStudio::Hexadecimal:
-        channels = m_frameParser->parse(QString::fromUtf8(data.toHex()));
-        break;
-      case SerialStudio::Base64:
-        channels = m_frameParser->parse(QString::fromUtf8(data.toBase64()));
-        break;
-      case SerialStudio::Binary:
-        channels = m_frameParser->parse(data);
-        break;
-      case SerialStudio::PlainText:
-      default:
-        channels = m_frameParser->parse(QString::fromUtf8(data));
-        break;
+      channels[i].value = values[i];
+      channels[i].isNumeric
+          = JSON::Dataset::parseNumber(values[i], channels[i].numericValue);
     }
   }
 
-  // CSV data, no need to perform conversions or use frame parser
-  else
-    channels = QString::fromUtf8(data).split(',', Qt::SkipEmptyParts);
+  // Replace data in frame & update user interface
+  updateProjectFrame(m_frame, channels);
+  hotpathTxFrame(m_frame);
+}
+
+/**
+ * @brief Assigns parsed channel values to the datasets of a project frame.
+ *
+ * Each dataset receives the channel that matches its (1-based) index,
+ * datasets whose index is out of range keep their previous value.
+ *
+ * The assignment walks the compiled channel table of the frame (see
+ * JSON::Frame::buildChannelSlots()). Channels already carry their numeric
+ * value, so datasets are updated without parsing anything.
+ *
+ * @param frame    Project frame to update.
+ * @param channels Values returned by the frame parser.
+ */
+void JSON::FrameBuilder::updateProjectFrame(
+    JSON::Frame &frame, const QVector<JSON::DatasetValue> &channels)
+{
+  const auto channelCount = channels.size();
+  for (const auto &slot : std::as_const(frame.m_channelSlots))
+  {
+    // Slots are sorted by channel, the remaining ones are out of range
+    if (slot.channel >= channelCount) [[unlikely]]
+      break;
+
+    const auto &channel = channels[slot.channel];
+    auto &dataset = frame.m_groups[slot.group].m_datasets[slot.dataset];
+    dataset.setValue(channel.value, channel.numericValue, channel.isNumeric);
+  }
+}
 
-  // Replace data in frame
-  const int channelCount = channels.size();
-  for (int g = 0; g < m_frame.groupCount(); ++g)
+/**
+ * @brief Decodes a fixed-layout binary frame into the datasets of @a frame.
+ *
+ * Uses the native decoder compiled from the binary layout of the project.
+ * Each field is decoded once and assigned to every dataset whose index
+ * matches it, fields that are not contained in @a data keep their previous
+ * values.
+ *
+ * @param frame Project frame to update.
+ * @param data  Raw binary frame.
+ */
+void JSON::FrameBuilder::updateBinaryFrame(JSON::Frame &frame,
+                                           const QByteArray &data)
+{
+  int decoded = -1;
+  bool valid = false;
+  double number = 0;
+  QString value;
+
+  const auto &decoder = frame.m_binaryDecoder;
+  const auto fieldCount = decoder.fieldCount();
+  for (const auto &slot : std::as_const(frame.m_channelSlots))
   {
-    auto &group = m_frame.m_groups[g];
-    for (int d = 0; d < group.datasetCount(); ++d)
+    // Slots are sorted by channel, the remaining ones have no field
+    if (slot.channel >= fieldCount) [[unlikely]]
+      break;
+
+    // Decode each field once, even if multiple datasets display it
+    if (slot.channel != decoded)
     {
-      auto &dataset = group.m_datasets[d];
-      const int idx = dataset.index();
-      if (idx > 0 && idx <= channelCount) [[likely]]
-        dataset.m_value = channels[idx - 1];
+      valid = decoder.decode(slot.channel, data, number, value);
+      decoded = slot.channel;
     }
-  }
 
-  // Update user interface
-  hotpathTxFrame(m_frame);
+    if (valid) [[likely]]
+    {
+      auto &dataset = frame.m_groups[slot.group].m_datasets[slot.dataset];
+      dataset.setValue(value, number, true);
+    }
+  }
 }
 
 /**
@@ -444,61 +1087,162 @@ void JSON::FrameBuilder::parseProjectFrame(const QByteArray &data)
  */
 void JSON::FrameBuilder::parseQuickPlotFrame(const QByteArray &data)
 {
-  // Create a vector of channels
-  QVector<QStringView> channels;
-  if (m_quickPlotChannels > 0) [[likely]]
-    channels.reserve(m_quickPlotChannels);
-  else
-    channels.reserve(64);
+  updateQuickPlotFrame(m_quickPlotFrame, m_quickPlotChannels,
+                       m_quickPlotSource, data);
+  hotpathTxFrame(m_quickPlotFrame);
+}
 
-  // Split the string into commas
-  int start = 0;
-  const auto str = QString::fromUtf8(data);
-  QStringView view(str);
-  const int dataLength = view.size();
-  for (int i = 0; i <= dataLength; ++i)
+/**
+ * @brief Splits a Quick Plot line into channels and updates @a frame.
+ *
+ * Rebuilds the frame layout via buildQuickPlotFrame() whenever the number of
+ * channels differs from @a channelCount, then assigns the channel values to
+ * the datasets of the frame.
+ *
+ * The line is tokenized directly on its UTF-8 bytes: commas are located with
+ * memchr(), tokens are trimmed by adjusting their bounds and numbers are
+ * parsed from the bytes into the datasets. Token storage is kept per thread
+ * and ASCII values are copied into the existing string of each dataset, so no
+ * allocations happen once the layout is stable.
+ *
+ * @param frame        Quick Plot frame to update.
+ * @param channelCount Number of channels of the current layout, updated if the
+ *                     layout is rebuilt.
+ * @param source       Input source settings, see quickPlotSource().
+ * @param data         UTF-8 encoded, comma-separated channel values.
+ */
+void JSON::FrameBuilder::updateQuickPlotFrame(
+    JSON::Frame &frame, int &channelCount, const JSON::QuickPlotSource &source,
+    const QByteArray &data)
+{
+  // Reuse the token storage of the calling thread between frames
+  static thread_local QVector<QByteArrayView> channels;
+  channels.clear();
+  if (channelCount > channels.capacity()) [[unlikely]]
+    channels.reserve(channelCount);
+
+  // Trims ASCII whitespace without copying the channel bytes
+  const auto trimmed = [](const char *begin, const char *end) {
+    const auto isSpace = [](char c) {
+      return c == ' ' || (c >= '\t' && c <= '\r');
+    };
+
+    while (begin < end && isSpace(*begin))
+      ++begin;
+    while (end > begin && isSpace(*(end - 1)))
+      --end;
+
+    return QByteArrayView(begin, end - begin);
+  };
+
+  // Split the UTF-8 bytes at each comma, memchr() is vectorized by the C
+  // library, so this scans the frame much faster than a per-character loop
+  const char *cursor = data.constData();
+  const char *end = cursor + data.size();
+  while (true)
   {
-    if (i == dataLength || view[i] == ',')
+    const auto *comma = static_cast<const char *>(
+        std::memchr(cursor, ',', static_cast<size_t>(end - cursor)));
+    if (!comma)
     {
-      channels.append(view.mid(start, i - start).trimmed());
-      start = i + 1;
+      channels.append(trimmed(cursor, end));
+      break;
     }
+
+    channels.append(trimmed(cursor, comma));
+    cursor = comma + 1;
   }
 
   // Regenerate the quick plot frame if needed
-  const int channelCount = channels.count();
-  if (channelCount != m_quickPlotChannels) [[unlikely]]
+  const int count = channels.count();
+  if (count != channelCount) [[unlikely]]
   {
     QStringList channelStrs;
-    channelStrs.reserve(channelCount);
-    for (const auto &v : channels)
-      channelStrs.append(v.toString());
+    channelStrs.reserve(count);
+    for (const auto &v : std::as_const(channels))
+      channelStrs.append(QString::fromUtf8(v));
 
-    buildQuickPlotFrame(channelStrs);
-    m_quickPlotChannels = channelCount;
+    buildQuickPlotFrame(frame, source, channelStrs);
+    channelCount = count;
   }
 
-  // Update the values of the quick plot frame
-  for (int g = 0; g < m_quickPlotFrame.groupCount(); ++g)
+  // Parse each channel directly from the frame bytes into its datasets, the
+  // text is written into the existing string of each dataset
+  int parsed = -1;
+  bool numeric = false;
+  double number = 0;
+  for (const auto &slot : std::as_const(frame.m_channelSlots))
   {
-    auto &group = m_quickPlotFrame.m_groups[g];
-    for (int d = 0; d < group.datasetCount(); ++d)
+    if (slot.channel >= count) [[unlikely]]
+      break;
+
+    const auto &channel = channels[slot.channel];
+    if (slot.channel != parsed)
     {
-      auto &dataset = group.m_datasets[d];
-      const int index = dataset.index();
-      if (index > 0 && index <= channelCount) [[likely]]
-        dataset.m_value = channels[index - 1].toString();
+      numeric = JSON::Dataset::parseNumber(channel.data(), channel.size(),
+                                           number);
+      parsed = slot.channel;
     }
-  }
 
-  // Process the frame
-  hotpathTxFrame(m_quickPlotFrame);
+    auto &dataset = frame.m_groups[slot.group].m_datasets[slot.dataset];
+    dataset.setValue(channel, number, numeric);
+  }
 }
 
 //------------------------------------------------------------------------------
 // Quick-plot project generation functions
 //------------------------------------------------------------------------------
 
+/**
+ * @brief Reads the input source settings that shape the Quick Plot layout.
+ *
+ * If the audio bus is selected, the sample range of the configured audio
+ * format and the sampling rate are obtained from the audio driver.
+ *
+ * Must be called from the GUI thread, the result is handed to the frame
+ * parsing thread so that it never accesses the I/O singletons.
+ */
+JSON::QuickPlotSource JSON::FrameBuilder::quickPlotSource()
+{
+  JSON::QuickPlotSource source;
+  if (IO::Manager::instance().busType() != SerialStudio::BusType::Audio)
+    return source;
+
+  // Get reference to Audio driver
+  const auto &audio = IO::Drivers::Audio::instance();
+  source.audio = true;
+  source.sampleRate = audio.config().sampleRate;
+
+  // Compute audio parameters
+  switch (audio.config().capture.format)
+  {
+    case ma_format_u8:
+      source.max = 255;
+      source.min = 0;
+      break;
+    case ma_format_s16:
+      source.max = 32767;
+      source.min = -32768;
+      break;
+    case ma_format_s24:
+      source.max = 8388607;
+      source.min = -8388608;
+      break;
+    case ma_format_s32:
+      source.max = 2147483647;
+      source.min = -2147483648;
+      break;
+    case ma_format_f32:
+      source.max = 1.0;
+      source.min = -1.0;
+      break;
+    default:
+      break;
+  }
+
+  return source;
+}
+
 /**
  * @brief Rebuilds the internal frame structure for Quick Plot mode based on
  *        current channel count.
@@ -510,8 +1254,12 @@ void JSON::FrameBuilder::parseQuickPlotFrame(const QByteArray &data)
  * a generic datagrid and multiplot view for standard Quick Plot channels.
  *
  * This function is only called when the number of input channels changes, not
- * on every data frame.
+ * on every data frame. It may be called from the frame parsing thread, so the
+ * bus type and audio configuration are passed in through @a source instead of
+ * being read from the I/O singletons.
  *
+ * @param frame    Frame that receives the generated layout.
+ * @param source   Input source settings, see quickPlotSource().
  * @param channels List of channel values received in the most recent data
  *                 frame.
  *
@@ -520,46 +1268,13 @@ void JSON::FrameBuilder::parseQuickPlotFrame(const QByteArray &data)
  *       of channels changes. Avoid calling this in the real-time path unless
  *       necessary.
  */
-void JSON::FrameBuilder::buildQuickPlotFrame(const QStringList &channels)
+void JSON::FrameBuilder::buildQuickPlotFrame(
+    JSON::Frame &frame, const JSON::QuickPlotSource &source,
+    const QStringList &channels)
 {
   // Parse audio data
-  const auto busType = IO::Manager::instance().busType();
-  if (busType == SerialStudio::BusType::Audio)
-  {
-    // Get reference to Audio driver
-    const auto &audio = IO::Drivers::Audio::instance();
-    const auto format = audio.config().capture.format;
-    const auto sampleRate = audio.config().sampleRate;
-
-    // Compute audio parameters
-    double maxValue = 1.0;
-    double minValue = 0.0;
-    switch (format)
-    {
-      case ma_format_u8:
-        maxValue = 255;
-        minValue = 0;
-        break;
-      case ma_format_s16:
-        maxValue = 32767;
-        minValue = -32768;
-        break;
-      case ma_format_s24:
-        maxValue = 8388607;
-        minValue = -8388608;
-        break;
-      case ma_format_s32:
-        maxValue = 2147483647;
-        minValue = -2147483648;
-        break;
-      case ma_format_f32:
-        maxValue = 1.0;
-        minValue = -1.0;
-        break;
-      default:
-        break;
-    }
-
+  if (source.audio)
+  {
     // Obtain microphone values for each channel
     int index = 1;
     QVector<JSON::Dataset> datasets;
@@ -570,13 +1285,13 @@ void JSON::FrameBuilder::buildQuickPlotFrame(const QStringList &channels)
       dataset.m_groupId = 0;
       dataset.m_graph = true;
       dataset.m_index = index;
-      dataset.m_max = maxValue;
-      dataset.m_min = minValue;
+      dataset.m_max = source.max;
+      dataset.m_min = source.min;
       dataset.m_fftSamples = 2048;
       dataset.m_fftWindowFn = "Hann";
-      dataset.m_fftSamplingRate = sampleRate;
+      dataset.m_fftSamplingRate = source.sampleRate;
       dataset.m_title = tr("Channel %1").arg(index);
-      dataset.m_value = channel;
+      dataset.setValue(channel);
       datasets.append(dataset);
 
       ++index;
@@ -590,12 +1305,14 @@ void JSON::FrameBuilder::buildQuickPlotFrame(const QStringList &channels)
       group.m_widget = QStringLiteral("multiplot");
 
     // Create a project frame object
-    m_quickPlotFrame.clear();
-    m_quickPlotFrame.m_title = tr("Quick Plot");
-    m_quickPlotFrame.m_groups.append(group);
+    frame.clear();
+    frame.m_title = tr("Quick Plot");
+    frame.m_groups.append(group);
 
     // Update user interface
-    m_quickPlotFrame.buildUniqueIds();
+    frame.buildUniqueIds();
+    frame.buildChannelSlots();
+    frame.buildStructureHash();
     return;
   }
 
@@ -608,7 +1325,7 @@ void JSON::FrameBuilder::buildQuickPlotFrame(const QStringList &channels)
     dataset.m_groupId = 0;
     dataset.m_index = idx;
     dataset.m_title = tr("Channel %1").arg(idx);
-    dataset.m_value = channel;
+    dataset.setValue(channel);
     dataset.m_graph = false;
     datasets.append(dataset);
 
@@ -616,8 +1333,8 @@ void JSON::FrameBuilder::buildQuickPlotFrame(const QStringList &channels)
   }
 
   // Create a project frame from the groups
-  m_quickPlotFrame.clear();
-  m_quickPlotFrame.m_title = tr("Quick Plot");
+  frame.clear();
+  frame.m_title = tr("Quick Plot");
 
   // Create a datagrid group from the dataset array
   JSON::Group datagrid(0);
@@ -628,7 +1345,7 @@ void JSON::FrameBuilder::buildQuickPlotFrame(const QStringList &channels)
     datagrid.m_datasets[i].m_graph = true;
 
   // Append datagrid to frame
-  m_quickPlotFrame.m_groups.append(datagrid);
+  frame.m_groups.append(datagrid);
 
   // Create a multiplot group when multiple datasets are found
   if (datasets.count() > 1)
@@ -640,11 +1357,13 @@ void JSON::FrameBuilder::buildQuickPlotFrame(const QStringList &channels)
     for (int i = 0; i < multiplot.m_datasets.count(); ++i)
       multiplot.m_datasets[i].m_groupId = 1;
 
-    m_quickPlotFrame.m_groups.append(multiplot);
+    frame.m_groups.append(multiplot);
   }
 
   // Update user interface
-  m_quickPlotFrame.buildUniqueIds();
+  frame.buildUniqueIds();
+  frame.buildChannelSlots();
+  frame.buildStructureHash();
 }
 
 //------------------------------------------------------------------------------
@@ -660,6 +1379,10 @@ void JSON::FrameBuilder::buildQuickPlotFrame(const QStringList &channels)
  * - The CSV export system for logging.
  * - The plugin server for external data consumption.
  *
+ * The CSV export and the plugin server receive a JSON::FrameRecord, which
+ * only contains the dataset values and shares the frame structure between
+ * consecutive frames. The record is only captured if any of them is enabled.
+ *
  * @param frame The fully populated frame to distribute.
  *
  * @note This function touches multiple subsystems, including I/O and UI.
@@ -673,6 +1396,33 @@ void JSON::FrameBuilder::hotpathTxFrame(const JSON::Frame &frame)
   static auto &pluginsServer = Plugins::Server::instance();
 
   dashboard.hotpathRxFrame(frame);
-  csvExport.hotpathTxFrame(frame);
-  pluginsServer.hotpathTxFrame(frame);
+  if (csvExport.exportEnabled() || pluginsServer.enabled())
+  {
+    const auto record = JSON::FrameRecord::capture(
+        frame, m_recordStructure, QDateTime::currentDateTime());
+    csvExport.hotpathTxFrame(record);
+    pluginsServer.hotpathTxFrame(record);
+  }
+}
+
+/**
+ * @brief Publishes a frame parsed by the pipeline thread.
+ *
+ * Same as hotpathTxFrame(const JSON::Frame &), but forwards the record that
+ * was captured by the pipeline thread, which keeps the time at which the raw
+ * frame was received, since the frame is published some time after that.
+ *
+ * @param frame  The fully populated frame to distribute.
+ * @param record Record of the dataset values of @a frame.
+ */
+void JSON::FrameBuilder::hotpathTxFrame(const JSON::Frame &frame,
+                                        const JSON::FrameRecord &record)
+{
+  static auto &csvExport = CSV::Export::instance();
+  static auto &dashboard = UI::Dashboard::instance();
+  static auto &pluginsServer = Plugins::Server::instance();
+
+  dashboard.hotpathRxFrame(frame);
+  csvExport.hotpathTxFrame(record);
+  pluginsServer.hotpathTxFrame(record);
 }
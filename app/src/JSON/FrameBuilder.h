@@ -22,7 +22,9 @@
 #pragma once
 
 #include <QFile>
+#include <QThread>
 #include <QObject>
+#include <QPointer>
 #include <QSettings>
 #include <QJsonArray>
 #include <QJsonValue>
@@ -33,6 +35,8 @@
 
 #include "JSON/Frame.h"
 #include "JSON/FrameParser.h"
+#include "JSON/FramePipeline.h"
+#include "JSON/StreamReader.h"
 
 namespace JSON
 {
@@ -61,11 +65,24 @@ class FrameBuilder : public QObject
              READ operationMode
              WRITE setOperationMode
              NOTIFY operationModeChanged)
+  Q_PROPERTY(bool threadedFrameParsing
+             READ threadedFrameParsing
+             WRITE setThreadedFrameParsing
+             NOTIFY threadedFrameParsingChanged)
+  Q_PROPERTY(int parserThreads
+             READ parserThreads
+             WRITE setParserThreads
+             NOTIFY parserThreadsChanged)
+  Q_PROPERTY(int maxParserThreads
+             READ maxParserThreads
+             CONSTANT)
   // clang-format on
 
 signals:
   void jsonFileMapChanged();
   void operationModeChanged();
+  void threadedFrameParsingChanged();
+  void parserThreadsChanged();
   void frameChanged(const JSON::Frame &frame);
 
 private:
@@ -75,6 +92,8 @@ private:
   FrameBuilder &operator=(FrameBuilder &&) = delete;
   FrameBuilder &operator=(const FrameBuilder &) = delete;
 
+  ~FrameBuilder();
+
 public:
   static FrameBuilder &instance();
 
@@ -82,27 +101,55 @@ public:
   [[nodiscard]] QString jsonMapFilename() const;
   [[nodiscard]] const JSON::Frame &frame() const;
   [[nodiscard]] JSON::FrameParser *frameParser() const;
+  [[nodiscard]] bool threadedFrameParsing() const;
+  [[nodiscard]] int parserThreads() const;
+  [[nodiscard]] int maxParserThreads() const;
+  [[nodiscard]] quint64 framesDropped() const;
+  [[nodiscard]] QList<QByteArray> warmupSamples() const;
   [[nodiscard]] SerialStudio::OperationMode operationMode() const;
 
+  static void updateQuickPlotFrame(JSON::Frame &frame, int &channelCount,
+                                   const JSON::QuickPlotSource &source,
+                                   const QByteArray &data);
+
 public slots:
   void setupExternalConnections();
   void loadJsonMap(const QString &path);
   void setFrameParser(JSON::FrameParser *editor);
+  void setThreadedFrameParsing(const bool enabled);
+  void setParserThreads(const int threads);
   void setOperationMode(const SerialStudio::OperationMode mode);
 
   void hotpathRxFrame(const QByteArray &data);
+  void hotpathRxFrames(const QList<QByteArray> &frames);
+  void hotpathPublishSnapshots();
+  void flushPipeline();
 
 private slots:
   void onConnectedChanged();
+  void configurePipeline();
 
 private:
+  void stopPipeline();
+  void startPipeline();
+  void stopPipelineThread();
+  void saveWarmupSamples();
   void setJsonPathSetting(const QString &path);
 
   void parseProjectFrame(const QByteArray &data);
   void parseQuickPlotFrame(const QByteArray &data);
-  void buildQuickPlotFrame(const QStringList &channels);
+
+  static void updateProjectFrame(JSON::Frame &frame,
+                                 const QVector<JSON::DatasetValue> &channels);
+  static void updateBinaryFrame(JSON::Frame &frame, const QByteArray &data);
+  static JSON::QuickPlotSource quickPlotSource();
+  static void buildQuickPlotFrame(JSON::Frame &frame,
+                                  const JSON::QuickPlotSource &source,
+                                  const QStringList &channels);
 
   void hotpathTxFrame(const JSON::Frame &frame);
+  void hotpathTxFrame(const JSON::Frame &frame,
+                      const JSON::FrameRecord &record);
 
 private:
   QFile m_jsonMap;
@@ -110,10 +157,29 @@ private:
   JSON::Frame m_frame;
   JSON::Frame m_rawFrame;
   JSON::Frame m_quickPlotFrame;
+  JSON::QuickPlotSource m_quickPlotSource;
+  JSON::StreamReader m_jsonReader;
 
   QSettings m_settings;
   int m_quickPlotChannels;
+  bool m_threadedFrameParsing;
+  int m_parserThreads;
   JSON::FrameParser *m_frameParser;
   SerialStudio::OperationMode m_opMode;
+
+  QThread m_pipelineThread;
+  JSON::ParserPool *m_parserPool;
+  JSON::ScriptParser *m_scriptParser;
+  QPointer<FramePipeline> m_pipeline;
+  quint64 m_pipelineFramesDropped;
+
+  QList<QByteArray> m_recordedFrames;
+
+  JSON::FrameRecord m_snapshot;
+  JSON::Frame m_snapshotFrame;
+  std::shared_ptr<const JSON::Frame> m_snapshotStructure;
+  std::shared_ptr<const JSON::Frame> m_recordStructure;
+
+  friend class FramePipeline;
 };
 } // namespace JSON
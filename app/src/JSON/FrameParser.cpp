@@ -20,7 +20,6 @@
  */
 
 #include <QFile>
-#include <QJSEngine>
 #include <QFileDialog>
 #include <QLineNumberArea>
 #include <QDesktopServices>
@@ -28,6 +27,7 @@
 #include <QJavascriptHighlighter>
 
 #include "JSON/FrameParser.h"
+#include "JSON/FrameBuilder.h"
 #include "JSON/ProjectModel.h"
 #include <QtGui/qshortcut.h>
 
@@ -79,10 +79,6 @@ JSON::FrameParser::FrameParser(QQuickItem *parent)
   m_widget.setHighlighter(new QJavascriptHighlighter());
   m_widget.setFont(Misc::CommonFonts::instance().monoFont());
 
-  // Configure JavaScript engine
-  m_engine.installExtensions(QJSEngine::ConsoleExtension
-                             | QJSEngine::GarbageCollectionExtension);
-
   // Load template code
   reload();
 
@@ -114,10 +110,6 @@ JSON::FrameParser::FrameParser(QQuickItem *parent)
   connect(this, &QQuickPaintedItem::heightChanged, this,
           &JSON::FrameParser::resizeWidget);
 
-  // Collect JS garbage at 1 Hz
-  connect(&Misc::TimerEvents::instance(), &Misc::TimerEvents::timeout1Hz,
-          &m_engine, &QJSEngine::collectGarbage);
-
   // Configure render loop
   connect(&Misc::TimerEvents::instance(), &Misc::TimerEvents::timeout24Hz, this,
           &JSON::FrameParser::renderWidget);
@@ -164,40 +156,20 @@ bool JSON::FrameParser::isModified() const
 }
 
 /**
- * @brief Executes the current frame parser function over UTF-8 text data.
+ * @brief Decodes a raw frame and executes the frame parser function over it.
  *
- * This version is used when the frame is already a decoded QString
- * (e.g., ASCII or UTF-8 text). It avoids any binary conversion and
- * sends the string directly to the JavaScript parser function.
+ * The frame is decoded and handed to the loaded code by JSON::ScriptParser,
+ * which also records the duration of each call in JSON::ParserProfiler.
  *
- * @param frame Decoded UTF-8 string frame (e.g., "value1,value2,value3").
- * @return An array of strings returned by the JS parser.
+ * @param data    Raw frame data.
+ * @param decoder Decoding method of the project.
+ * @return The channel values returned by the JS frame parser.
  */
-QStringList JSON::FrameParser::parse(const QString &frame)
+QVector<JSON::DatasetValue>
+JSON::FrameParser::parse(const QByteArray &data,
+                         const SerialStudio::DecoderMethod decoder)
 {
-  QJSValueList args;
-  args << frame;
-
-  return m_parseFunction.call(args).toVariant().toStringList();
-}
-
-/**
- * @brief Executes the current frame parser function over the input binary data.
- *
- * @param frame Binary frame data (e.g., from serial input).
- * @return Parsed string fields returned by the JS frame parser.
- */
-QStringList JSON::FrameParser::parse(const QByteArray &frame)
-{
-  QJSValue jsArray = m_engine.newArray(frame.size());
-  const auto *data = reinterpret_cast<const quint8 *>(frame.constData());
-  for (int i = 0; i < frame.size(); ++i)
-    jsArray.setProperty(i, data[i]);
-
-  QJSValueList args;
-  args << jsArray;
-
-  return m_parseFunction.call(args).toVariant().toStringList();
+  return m_parser.parse(data, decoder);
 }
 
 /**
@@ -269,24 +241,6 @@ bool JSON::FrameParser::save(const bool silent)
  */
 bool JSON::FrameParser::loadScript(const QString &script)
 {
-  // Ensure that engine is configured correctly
-  m_engine.installExtensions(QJSEngine::AllExtensions);
-
-  // Check if there are no general JS errors
-  QStringList errors;
-  m_engine.evaluate(script, "", 1, &errors);
-
-  // Check if the 'parse' function exists and is callable
-  auto fun = m_engine.globalObject().property("parse");
-  if (fun.isNull() || !fun.isCallable())
-  {
-    Misc::Utilities::showMessageBox(
-        tr("Frame parser error!"),
-        tr("The 'parse' function is not declared or is not callable!"),
-        QMessageBox::Critical);
-    return false;
-  }
-
   // Check if the script contains a valid parse function declaratio
   static QRegularExpression functionRegex(
       R"(\bfunction\s+parse\s*\(\s*([a-zA-Z_$][a-zA-Z0-9_$]*)(\s*,\s*([a-zA-Z_$][a-zA-Z0-9_$]*))?\s*\))");
@@ -331,8 +285,20 @@ bool JSON::FrameParser::loadScript(const QString &script)
     return false;
   }
 
-  // We have reached this point without any errors, set function caller
-  m_parseFunction = fun;
+  // Load the code & compile it before the device starts sending data
+  const auto &project = ProjectModel::instance();
+  const auto decoder = project.decoderMethod();
+  const auto stateless = project.statelessParser();
+  const auto samples = FrameBuilder::instance().warmupSamples();
+  if (!m_parser.load(script, decoder, stateless, samples))
+  {
+    Misc::Utilities::showMessageBox(
+        tr("Frame parser error!"),
+        tr("The 'parse' function is not declared or is not callable!"),
+        QMessageBox::Critical);
+    return false;
+  }
+
   return true;
 }
 
@@ -23,12 +23,14 @@
 
 #include <QEvent>
 #include <QPainter>
-#include <QJSValue>
-#include <QJSEngine>
 #include <QCodeEditor>
 #include <QSyntaxStyle>
 #include <QQuickPaintedItem>
 
+#include "SerialStudio.h"
+#include "JSON/Frame.h"
+#include "JSON/ScriptParser.h"
+
 namespace JSON
 {
 class FrameParser : public QQuickPaintedItem
@@ -51,8 +53,8 @@ public:
   [[nodiscard]] QString text() const;
   [[nodiscard]] bool isModified() const;
 
-  [[nodiscard]] QStringList parse(const QString &frame);
-  [[nodiscard]] QStringList parse(const QByteArray &frame);
+  [[nodiscard]] QVector<JSON::DatasetValue>
+  parse(const QByteArray &data, const SerialStudio::DecoderMethod decoder);
 
   [[nodiscard]] bool undoAvailable() const;
   [[nodiscard]] bool redoAvailable() const;
@@ -98,9 +100,8 @@ private:
 
 private:
   QPixmap m_pixmap;
-  QJSEngine m_engine;
   QSyntaxStyle m_style;
   QCodeEditor m_widget;
-  QJSValue m_parseFunction;
+  ScriptParser m_parser;
 };
 } // namespace JSON
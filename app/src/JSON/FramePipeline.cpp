@@ -0,0 +1,364 @@
+/*
+ * Serial Studio
+ * https://serial-studio.com/
+ *
+ * Copyright (C) 2020–2025 Alex Spataru
+ *
+ * This file is dual-licensed:
+ *
+ * - Under the GNU GPLv3 (or later) for builds that exclude Pro modules.
+ * - Under the Serial Studio Commercial License for builds that include
+ *   any Pro functionality.
+ *
+ * You must comply with the terms of one of these licenses, depending
+ * on your use case.
+ *
+ * For GPL terms, see <https://www.gnu.org/licenses/gpl-3.0.html>
+ * For commercial terms, see LICENSE_COMMERCIAL.md in the project root.
+ *
+ * SPDX-License-Identifier: GPL-3.0-only OR LicenseRef-SerialStudio-Commercial
+ */
+
+#include <QElapsedTimer>
+
+#include "JSON/FrameBuilder.h"
+#include "JSON/FramePipeline.h"
+
+//------------------------------------------------------------------------------
+// Constructor function
+//------------------------------------------------------------------------------
+
+/**
+ * @brief Constructs an unconfigured frame pipeline.
+ *
+ * The JavaScript engines are loaded by configure(), so that they are owned by
+ * the threads that will execute the frame parser code. The @a parser and the
+ * @a pool must live in the pipeline thread and outlive the pipeline.
+ *
+ * @param parser Script parser used for single-threaded project parsing.
+ * @param pool   Parser pool used for parallel project parsing.
+ * @param parent The parent QObject (optional).
+ */
+JSON::FramePipeline::FramePipeline(JSON::ScriptParser *parser,
+                                   JSON::ParserPool *pool, QObject *parent)
+  : QObject(parent)
+  , m_quickPlotChannels(-1)
+  , m_opMode(SerialStudio::QuickPlot)
+  , m_decoder(SerialStudio::PlainText)
+  , m_pool(pool)
+  , m_parser(parser)
+{
+  connect(m_pool, &ParserPool::framesParsed, this,
+          &FramePipeline::publishParsedFrames);
+}
+
+/**
+ * @brief Discards the frames of the session that are still in the parser
+ *        pool, keeping its engines loaded for the next session.
+ */
+JSON::FramePipeline::~FramePipeline()
+{
+  if (m_pool)
+    m_pool->clear();
+}
+
+//------------------------------------------------------------------------------
+// Snapshot access
+//------------------------------------------------------------------------------
+
+/**
+ * @brief Takes the oldest published snapshot.
+ *
+ * Snapshots are frame records, the GUI thread applies their values to its own
+ * copy of the shared frame structure.
+ *
+ * Must only be called from the GUI thread.
+ *
+ * @param snapshot Receives the snapshot.
+ * @return @c true if a snapshot was available, @c false otherwise.
+ */
+bool JSON::FramePipeline::takeSnapshot(JSON::FrameRecord &snapshot)
+{
+  return m_snapshots.dequeue(snapshot);
+}
+
+/**
+ * @brief Returns the number of frames lost because the parser pool or the GUI
+ *        thread did not process them in time.
+ *
+ * May be called from any thread.
+ */
+quint64 JSON::FramePipeline::framesDropped() const
+{
+  return m_snapshots.dropped() + m_poolDropped.load(std::memory_order_relaxed);
+}
+
+//------------------------------------------------------------------------------
+// Configuration
+//------------------------------------------------------------------------------
+
+/**
+ * @brief Sets the policy applied when the snapshot queue or the parser pool
+ *        is full.
+ *
+ * Must be called from the pipeline thread (or before it starts).
+ *
+ * @param policy The backpressure policy selected for the frame queue.
+ */
+void JSON::FramePipeline::setQueuePolicy(const IO::QueuePolicy policy)
+{
+  m_snapshots.setPolicy(policy);
+}
+
+/**
+ * @brief Updates the parsing configuration of the pipeline.
+ *
+ * Called through a queued connection whenever the operation mode, project
+ * structure or frame parser code changes. The frame parser code is loaded
+ * into a JavaScript engine that belongs to the pipeline thread, or into the
+ * engines of a parser pool if more than one parser thread is requested.
+ *
+ * @param frame         Project frame structure (used in project mode).
+ * @param script        Frame parser code (used in project mode).
+ * @param mode          Active operation mode.
+ * @param decoder       Decoding method applied to raw project frames.
+ * @param stateless     Whether the project declares its parser as stateless.
+ * @param parserThreads Number of threads that run the frame parser code.
+ * @param samples       Raw frames used to warm up the frame parser code.
+ * @param quickPlot     Input source settings used to build Quick Plot frames.
+ */
+void JSON::FramePipeline::configure(const JSON::Frame &frame,
+                                    const QString &script,
+                                    const SerialStudio::OperationMode mode,
+                                    const SerialStudio::DecoderMethod decoder,
+                                    const bool stateless,
+                                    const int parserThreads,
+                                    const QList<QByteArray> &samples,
+                                    const JSON::QuickPlotSource &quickPlot)
+{
+  // Update parsing state
+  m_opMode = mode;
+  m_frame = frame;
+  m_decoder = decoder;
+  m_structure.reset();
+  m_jsonReader.reset();
+  m_quickPlotChannels = -1;
+  m_quickPlotFrame.clear();
+  m_quickPlotSource = quickPlot;
+
+  // Only project mode requires a JavaScript parser, binary layouts are
+  // decoded natively without running any parser code
+  const bool binaryLayout
+      = decoder == SerialStudio::Binary && !frame.binaryDecoder().isEmpty();
+  if (mode != SerialStudio::ProjectFile || binaryLayout)
+  {
+    m_pool->stop();
+    m_parser->reset();
+    return;
+  }
+
+  // Load the parser code into the pool or into the pipeline thread, engines
+  // that already run the same stateless code are kept warm
+  if (parserThreads > 1)
+  {
+    m_parser->reset();
+    m_pool->start(parserThreads, script, decoder, samples);
+  }
+
+  else
+  {
+    m_pool->stop();
+    m_parser->load(script, decoder, stateless, samples);
+  }
+}
+
+//------------------------------------------------------------------------------
+// Frame processing
+//------------------------------------------------------------------------------
+
+/**
+ * @brief Parses a batch of raw frames and publishes the resulting snapshots.
+ *
+ * @param frames     Raw frames, in the order in which they were received.
+ * @param rxDateTime Time at which the batch was received.
+ */
+void JSON::FramePipeline::processFrames(const QList<QByteArray> &frames,
+                                        const QDateTime &rxDateTime)
+{
+  switch (m_opMode)
+  {
+    case SerialStudio::QuickPlot:
+      for (const auto &data : frames)
+      {
+        FrameBuilder::updateQuickPlotFrame(
+            m_quickPlotFrame, m_quickPlotChannels, m_quickPlotSource, data);
+        publish(m_quickPlotFrame, rxDateTime);
+      }
+      break;
+    case SerialStudio::ProjectFile:
+      if (m_pool->isActive())
+      {
+        for (const auto &data : frames)
+          submitToPool(data, rxDateTime);
+
+        break;
+      }
+
+      for (const auto &data : frames)
+      {
+        parseProjectFrame(data);
+        publish(m_frame, rxDateTime);
+      }
+      break;
+    case SerialStudio::DeviceSendsJSON:
+      for (const auto &data : frames)
+      {
+        if (!m_jsonReader.read(data, m_rawFrame))
+          continue;
+
+        if (m_jsonReader.rebuilt()) [[unlikely]]
+          m_structure.reset();
+
+        publish(m_rawFrame, rxDateTime);
+      }
+      break;
+  }
+}
+
+/**
+ * @brief Reports when every frame handed to the pipeline has been published.
+ *
+ * Frame batches are processed in the order in which they were queued, so all
+ * batches queued before this call have been parsed when it runs. Frames that
+ * are still being parsed by the parser pool are waited for by queueing the
+ * check again, which lets the pool deliver its results in between.
+ *
+ * @param state Marked as done once no frame is pending, which wakes every
+ *              thread waiting on its condition.
+ */
+void JSON::FramePipeline::finish(
+    const std::shared_ptr<JSON::FlushState> &state)
+{
+  if (m_pool->isActive() && m_pool->pendingFrames() > 0)
+  {
+    QMetaObject::invokeMethod(
+        this, [this, state] { finish(state); }, Qt::QueuedConnection);
+    return;
+  }
+
+  QMutexLocker locker(&state->mutex);
+  state->done = true;
+  state->condition.wakeAll();
+}
+
+/**
+ * @brief Decodes a project frame and assigns the values to its datasets.
+ *
+ * Mirrors JSON::FrameBuilder::parseProjectFrame(), but uses the JavaScript
+ * engine owned by the pipeline thread. Binary frames of projects with a binary
+ * layout are decoded natively.
+ *
+ * @param data Raw frame data.
+ */
+void JSON::FramePipeline::parseProjectFrame(const QByteArray &data)
+{
+  if (m_decoder == SerialStudio::Binary && !m_frame.binaryDecoder().isEmpty())
+  {
+    FrameBuilder::updateBinaryFrame(m_frame, data);
+    return;
+  }
+
+  FrameBuilder::updateProjectFrame(m_frame, m_parser->parse(data));
+}
+
+/**
+ * @brief Hands a project frame to the parser pool, applying backpressure.
+ *
+ * If the pool already holds its maximum number of frames in flight (e.g.
+ * because the parser code is too slow, or one worker stalls), the same policy
+ * as for the snapshot queue decides which frame is lost:
+ * - DropNewest: @a data is discarded.
+ * - DropOldest: the oldest frame in flight is discarded.
+ * - Block: waits up to BLOCK_TIMEOUT_MS for the oldest frame to be parsed,
+ *   publishing it to make room, then discards @a data.
+ * - Grow: the frame is always submitted.
+ *
+ * @param data       Raw frame data.
+ * @param rxDateTime Time at which the raw frame was received.
+ */
+void JSON::FramePipeline::submitToPool(const QByteArray &data,
+                                       const QDateTime &rxDateTime)
+{
+  // Apply the backpressure policy if the pool is full
+  if (m_pool->isFull()) [[unlikely]]
+  {
+    using Queue = IO::BackpressureQueue<JSON::FrameRecord>;
+    switch (m_snapshots.policy())
+    {
+      case IO::QueuePolicy::DropOldest:
+        m_pool->discardOldest();
+        m_poolDropped.fetch_add(1, std::memory_order_relaxed);
+        publishParsedFrames();
+        break;
+      case IO::QueuePolicy::Block: {
+        QElapsedTimer timer;
+        timer.start();
+        while (m_pool->isFull() && timer.elapsed() < Queue::BLOCK_TIMEOUT_MS)
+        {
+          m_pool->waitForResult(Queue::BLOCK_TIMEOUT_MS - timer.elapsed());
+          publishParsedFrames();
+        }
+        break;
+      }
+      default:
+        break;
+    }
+
+    // Discard the frame if no room could be made
+    if (m_snapshots.policy() != IO::QueuePolicy::Grow && m_pool->isFull())
+    {
+      m_poolDropped.fetch_add(1, std::memory_order_relaxed);
+      return;
+    }
+  }
+
+  m_pool->submit(data, rxDateTime);
+}
+
+/**
+ * @brief Publishes the project frames returned by the parser pool.
+ *
+ * Frames are taken in the order in which they were received, a frame that is
+ * still being parsed holds back the ones that follow it.
+ */
+void JSON::FramePipeline::publishParsedFrames()
+{
+  QDateTime rxDateTime;
+  QVector<JSON::DatasetValue> channels;
+  while (m_pool->takeResult(channels, rxDateTime))
+  {
+    FrameBuilder::updateProjectFrame(m_frame, channels);
+    publish(m_frame, rxDateTime);
+  }
+}
+
+/**
+ * @brief Publishes the dataset values of @a frame for the GUI thread.
+ *
+ * The frame structure is only copied when it changes, every other snapshot
+ * shares it and carries the dataset values alone. If the snapshot queue is
+ * full, the backpressure policy decides which snapshot is lost, the pipeline
+ * thread may wait for the GUI thread under the Block policy.
+ *
+ * @param frame      Frame with the latest dataset values.
+ * @param rxDateTime Time at which the raw frame was received.
+ */
+void JSON::FramePipeline::publish(const JSON::Frame &frame,
+                                  const QDateTime &rxDateTime)
+{
+  if (!frame.isValid()) [[unlikely]]
+    return;
+
+  m_snapshots.enqueue(FrameRecord::capture(frame, m_structure, rxDateTime),
+                      true);
+}
@@ -0,0 +1,150 @@
+/*
+ * Serial Studio
+ * https://serial-studio.com/
+ *
+ * Copyright (C) 2020–2025 Alex Spataru
+ *
+ * This file is dual-licensed:
+ *
+ * - Under the GNU GPLv3 (or later) for builds that exclude Pro modules.
+ * - Under the Serial Studio Commercial License for builds that include
+ *   any Pro functionality.
+ *
+ * You must comply with the terms of one of these licenses, depending
+ * on your use case.
+ *
+ * For GPL terms, see <https://www.gnu.org/licenses/gpl-3.0.html>
+ * For commercial terms, see LICENSE_COMMERCIAL.md in the project root.
+ *
+ * SPDX-License-Identifier: GPL-3.0-only OR LicenseRef-SerialStudio-Commercial
+ */
+
+#pragma once
+
+#include <atomic>
+#include <memory>
+#include <QObject>
+#include <QMutex>
+#include <QPointer>
+#include <QDateTime>
+#include <QByteArray>
+#include <QWaitCondition>
+
+#include "SerialStudio.h"
+#include "JSON/Frame.h"
+#include "JSON/ParserPool.h"
+#include "JSON/ScriptParser.h"
+#include "JSON/StreamReader.h"
+#include "IO/BackpressureQueue.h"
+
+namespace JSON
+{
+/**
+ * @brief Input source settings that shape the Quick Plot frame layout.
+ *
+ * Read on the GUI thread when a device connects, so that Quick Plot frames
+ * can be built on the frame parsing thread without accessing the I/O
+ * singletons.
+ */
+struct QuickPlotSource
+{
+  bool audio = false; ///< Whether the data comes from the audio driver
+  double min = 0;     ///< Minimum sample value of the audio format
+  double max = 1;     ///< Maximum sample value of the audio format
+  int sampleRate = 0; ///< Audio sampling rate, used for FFT plots
+};
+
+/**
+ * @brief Completion state of FramePipeline::finish().
+ *
+ * Shared between the pipeline thread, which sets @c done once every queued
+ * frame has been published, and the thread that waits for the flush.
+ */
+struct FlushState
+{
+  QMutex mutex;             ///< Guards @c done
+  QWaitCondition condition; ///< Signalled when @c done is set
+  bool done = false;        ///< Whether every pending frame was published
+};
+
+/**
+ * @class JSON::FramePipeline
+ * @brief Worker that parses raw frames outside of the GUI thread.
+ *
+ * When threaded frame parsing is enabled, JSON::FrameBuilder moves an instance
+ * of this class to a dedicated thread and forwards batches of raw frames to
+ * it. The pipeline decodes each frame (Quick Plot CSV, device-sent JSON or
+ * project frames through its own JavaScript engine), fills the dataset values
+ * of a private copy of the frame structure and publishes the values as a
+ * JSON::FrameRecord, which shares the frame structure between snapshots.
+ *
+ * The GUI thread collects published snapshots with takeSnapshot(), which keeps
+ * JavaScript execution and string processing from competing with rendering.
+ *
+ * If parallel parsing is requested, project frames are parsed by a
+ * JSON::ParserPool instead, and the pipeline publishes them in the order in
+ * which they were received as soon as the workers return them.
+ *
+ * The script parser and the parser pool are owned by JSON::FrameBuilder and
+ * outlive the pipeline, which only exists while a device is connected, so
+ * that warm engines are reused when the device reconnects.
+ *
+ * The snapshot queue and the frames in flight in the parser pool are bounded,
+ * when the GUI thread or the pool falls behind the same backpressure policy
+ * as the frame reader queue is applied, and lost frames are counted in
+ * framesDropped().
+ *
+ * @note The snapshot queue is single-producer/single-consumer: only the
+ *       pipeline thread publishes, and only the GUI thread takes snapshots.
+ */
+class FramePipeline : public QObject
+{
+  Q_OBJECT
+
+public:
+  explicit FramePipeline(JSON::ScriptParser *parser, JSON::ParserPool *pool,
+                         QObject *parent = nullptr);
+  ~FramePipeline();
+
+  bool takeSnapshot(JSON::FrameRecord &snapshot);
+  [[nodiscard]] quint64 framesDropped() const;
+
+public slots:
+  void setQueuePolicy(const IO::QueuePolicy policy);
+  void configure(const JSON::Frame &frame, const QString &script,
+                 const SerialStudio::OperationMode mode,
+                 const SerialStudio::DecoderMethod decoder,
+                 const bool stateless, const int parserThreads,
+                 const QList<QByteArray> &samples,
+                 const JSON::QuickPlotSource &quickPlot);
+  void processFrames(const QList<QByteArray> &frames,
+                     const QDateTime &rxDateTime);
+  void finish(const std::shared_ptr<JSON::FlushState> &state);
+
+private slots:
+  void publishParsedFrames();
+
+private:
+  void parseProjectFrame(const QByteArray &data);
+  void submitToPool(const QByteArray &data, const QDateTime &rxDateTime);
+  void publish(const JSON::Frame &frame, const QDateTime &rxDateTime);
+
+private:
+  int m_quickPlotChannels;
+  SerialStudio::OperationMode m_opMode;
+  SerialStudio::DecoderMethod m_decoder;
+
+  QPointer<JSON::ParserPool> m_pool;
+  QPointer<JSON::ScriptParser> m_parser;
+
+  JSON::Frame m_frame;
+  JSON::Frame m_rawFrame;
+  JSON::Frame m_quickPlotFrame;
+  JSON::QuickPlotSource m_quickPlotSource;
+  JSON::StreamReader m_jsonReader;
+
+  std::atomic<quint64> m_poolDropped{0};
+  std::shared_ptr<const JSON::Frame> m_structure;
+  IO::BackpressureQueue<JSON::FrameRecord> m_snapshots{4096};
+};
+} // namespace JSON
@@ -34,6 +34,7 @@ namespace JSON
 class Frame;
 class ProjectModel;
 class FrameBuilder;
+struct FrameRecord;
 } // namespace JSON
 
 namespace JSON
@@ -87,5 +88,6 @@ private:
   friend class JSON::Frame;
   friend class JSON::ProjectModel;
   friend class JSON::FrameBuilder;
+  friend struct JSON::FrameRecord;
 };
 } // namespace JSON
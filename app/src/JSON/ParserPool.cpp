@@ -0,0 +1,311 @@
+/*
+ * Serial Studio
+ * https://serial-studio.com/
+ *
+ * Copyright (C) 2020–2025 Alex Spataru
+ *
+ * This file is dual-licensed:
+ *
+ * - Under the GNU GPLv3 (or later) for builds that exclude Pro modules.
+ * - Under the Serial Studio Commercial License for builds that include
+ *   any Pro functionality.
+ *
+ * You must comply with the terms of one of these licenses, depending
+ * on your use case.
+ *
+ * For GPL terms, see <https://www.gnu.org/licenses/gpl-3.0.html>
+ * For commercial terms, see LICENSE_COMMERCIAL.md in the project root.
+ *
+ * SPDX-License-Identifier: GPL-3.0-only OR LicenseRef-SerialStudio-Commercial
+ */
+
+#include <QDeadlineTimer>
+
+#include "JSON/ParserPool.h"
+
+//------------------------------------------------------------------------------
+// Constructor & destructor functions
+//------------------------------------------------------------------------------
+
+/**
+ * @brief Constructs an inactive parser pool.
+ *
+ * @param parent The parent QObject (optional).
+ */
+JSON::ParserPool::ParserPool(QObject *parent)
+  : QObject(parent)
+  , m_nextWorker(0)
+  , m_nextResult(0)
+  , m_nextSequence(0)
+{
+}
+
+/**
+ * @brief Stops all worker threads.
+ */
+JSON::ParserPool::~ParserPool()
+{
+  stop();
+}
+
+//------------------------------------------------------------------------------
+// State access functions
+//------------------------------------------------------------------------------
+
+/**
+ * @brief Returns @c true if the maximum number of frames is in flight, i.e.
+ *        submitted but not taken with takeResult() yet.
+ */
+bool JSON::ParserPool::isFull() const
+{
+  const auto capacity = static_cast<quint64>(m_workers.count())
+                        * static_cast<quint64>(FRAMES_PER_WORKER);
+  return pendingFrames() >= capacity;
+}
+
+/**
+ * @brief Returns @c true if the pool has worker threads running.
+ */
+bool JSON::ParserPool::isActive() const
+{
+  return !m_workers.isEmpty();
+}
+
+/**
+ * @brief Returns the number of submitted frames that have not been taken with
+ *        takeResult() yet.
+ */
+quint64 JSON::ParserPool::pendingFrames() const
+{
+  QMutexLocker locker(&m_mutex);
+  return m_nextSequence - m_nextResult;
+}
+
+/**
+ * @brief Returns the number of workers to use on the current machine.
+ *
+ * Two cores are left for the GUI thread and for the thread that feeds the
+ * pool, but at least two workers are always used.
+ */
+int JSON::ParserPool::idealWorkerCount()
+{
+  return qMax(2, QThread::idealThreadCount() - 2);
+}
+
+//------------------------------------------------------------------------------
+// Worker management
+//------------------------------------------------------------------------------
+
+/**
+ * @brief Stops all worker threads and discards pending results.
+ *
+ * Frames that were submitted but not parsed yet are dropped. Sequence numbers
+ * keep increasing, so that results posted by the stopped workers are ignored.
+ */
+void JSON::ParserPool::stop()
+{
+  for (auto *thread : std::as_const(m_threads))
+  {
+    thread->quit();
+    thread->wait();
+    delete thread;
+  }
+
+  m_threads.clear();
+  m_workers.clear();
+  m_nextWorker = 0;
+  m_scriptHash.clear();
+
+  clear();
+}
+
+/**
+ * @brief Discards every frame in flight, keeping the workers running.
+ *
+ * Used when a session ends, so that the warm engines of the workers can be
+ * reused by the next session without receiving any of the old frames.
+ */
+void JSON::ParserPool::clear()
+{
+  QMutexLocker locker(&m_mutex);
+  m_results.clear();
+  m_nextResult = m_nextSequence;
+}
+
+/**
+ * @brief Starts @a workers threads with the given frame parser code loaded.
+ *
+ * Running workers are kept if they already run the same code, otherwise they
+ * are stopped first. Each worker creates its own JavaScript engine in its own
+ * thread and warms it up with @a samples.
+ *
+ * @param workers Number of worker threads to start.
+ * @param script  Frame parser code of the project.
+ * @param decoder Decoding method applied to raw frames before parsing them.
+ * @param samples Raw frames used to warm up the parser code.
+ */
+void JSON::ParserPool::start(const int workers, const QString &script,
+                             const SerialStudio::DecoderMethod decoder,
+                             const QList<QByteArray> &samples)
+{
+  const auto hash = ScriptParser::scriptHash(script, decoder);
+  if (m_workers.count() == workers && hash == m_scriptHash)
+    return;
+
+  stop();
+  m_scriptHash = hash;
+
+  for (int i = 0; i < workers; ++i)
+  {
+    auto *thread = new QThread();
+    auto *worker = new ScriptParser();
+    worker->moveToThread(thread);
+    connect(thread, &QThread::finished, worker, &QObject::deleteLater);
+    thread->start();
+
+    QMetaObject::invokeMethod(
+        worker,
+        [worker, script, decoder, samples] {
+          worker->load(script, decoder, true, samples);
+        },
+        Qt::QueuedConnection);
+
+    m_threads.append(thread);
+    m_workers.append(worker);
+  }
+}
+
+//------------------------------------------------------------------------------
+// Frame processing
+//------------------------------------------------------------------------------
+
+/**
+ * @brief Queues a raw frame for parsing on the next worker thread.
+ *
+ * The frame is queued even if the pool is full, the caller is expected to
+ * check isFull() first and to apply its backpressure policy.
+ *
+ * Workers store their results directly in the pool, which is safe because
+ * stop() joins every worker thread before the pool is destroyed.
+ *
+ * @param data       Raw frame data.
+ * @param rxDateTime Time at which the raw frame was received.
+ */
+void JSON::ParserPool::submit(const QByteArray &data,
+                              const QDateTime &rxDateTime)
+{
+  if (!isActive()) [[unlikely]]
+    return;
+
+  const auto sequence = m_nextSequence++;
+  QPointer<ScriptParser> worker = m_workers[m_nextWorker];
+  m_nextWorker = (m_nextWorker + 1) % m_workers.count();
+
+  QMetaObject::invokeMethod(
+      worker,
+      [this, worker, sequence, data, rxDateTime] {
+        // Skip frames that were discarded while they waited in the queue
+        if (!worker || isObsolete(sequence))
+          return;
+
+        storeResult(sequence, worker->parse(data), rxDateTime);
+      },
+      Qt::QueuedConnection);
+}
+
+/**
+ * @brief Takes the next parsed frame, in submission order.
+ *
+ * @param values     Receives the channel values returned by the parser.
+ * @param rxDateTime Receives the time at which the raw frame was received.
+ *
+ * @return @c true if the next frame in sequence was available.
+ */
+bool JSON::ParserPool::takeResult(QVector<JSON::DatasetValue> &values,
+                                  QDateTime &rxDateTime)
+{
+  QMutexLocker locker(&m_mutex);
+  auto it = m_results.find(m_nextResult);
+  if (it == m_results.end())
+    return false;
+
+  values = std::move(it->values);
+  rxDateTime = it->rxDateTime;
+  m_results.erase(it);
+  ++m_nextResult;
+  return true;
+}
+
+/**
+ * @brief Discards the oldest frame in flight to make room for a new one.
+ *
+ * If the frame is still waiting for its worker, the worker skips it, if it
+ * has already been parsed its result is deleted. Frames that follow it may
+ * become available to takeResult() afterwards.
+ */
+void JSON::ParserPool::discardOldest()
+{
+  QMutexLocker locker(&m_mutex);
+  if (m_nextResult == m_nextSequence) [[unlikely]]
+    return;
+
+  m_results.remove(m_nextResult);
+  ++m_nextResult;
+}
+
+/**
+ * @brief Waits until the next frame in sequence has been parsed.
+ *
+ * @param timeoutMs Maximum time to wait, in milliseconds.
+ * @return @c true if takeResult() can return a frame.
+ */
+bool JSON::ParserPool::waitForResult(const qint64 timeoutMs)
+{
+  QMutexLocker locker(&m_mutex);
+  QDeadlineTimer deadline(timeoutMs);
+  while (!m_results.contains(m_nextResult))
+  {
+    if (!m_resultReady.wait(&m_mutex, deadline))
+      break;
+  }
+
+  return m_results.contains(m_nextResult);
+}
+
+/**
+ * @brief Returns @c true if the frame with the given @a sequence number was
+ *        discarded or submitted before the pool was restarted.
+ *
+ * Called from the worker threads.
+ */
+bool JSON::ParserPool::isObsolete(const quint64 sequence) const
+{
+  QMutexLocker locker(&m_mutex);
+  return sequence < m_nextResult;
+}
+
+/**
+ * @brief Stores a frame parsed by one of the workers.
+ *
+ * Results that arrive ahead of their turn are kept until all previous frames
+ * have been parsed. Called from the worker threads, the framesParsed() signal
+ * reaches the owner of the pool through a queued connection.
+ */
+void JSON::ParserPool::storeResult(const quint64 sequence,
+                                   QVector<JSON::DatasetValue> &&values,
+                                   const QDateTime &rxDateTime)
+{
+  QMutexLocker locker(&m_mutex);
+
+  // Discard results of frames that are no longer expected
+  if (sequence < m_nextResult) [[unlikely]]
+    return;
+
+  m_results.insert(sequence, Result{std::move(values), rxDateTime});
+  if (sequence != m_nextResult)
+    return;
+
+  m_resultReady.wakeAll();
+  locker.unlock();
+  Q_EMIT framesParsed();
+}
@@ -0,0 +1,113 @@
+/*
+ * Serial Studio
+ * https://serial-studio.com/
+ *
+ * Copyright (C) 2020–2025 Alex Spataru
+ *
+ * This file is dual-licensed:
+ *
+ * - Under the GNU GPLv3 (or later) for builds that exclude Pro modules.
+ * - Under the Serial Studio Commercial License for builds that include
+ *   any Pro functionality.
+ *
+ * You must comply with the terms of one of these licenses, depending
+ * on your use case.
+ *
+ * For GPL terms, see <https://www.gnu.org/licenses/gpl-3.0.html>
+ * For commercial terms, see LICENSE_COMMERCIAL.md in the project root.
+ *
+ * SPDX-License-Identifier: GPL-3.0-only OR LicenseRef-SerialStudio-Commercial
+ */
+
+#pragma once
+
+#include <QHash>
+#include <QMutex>
+#include <QObject>
+#include <QThread>
+#include <QPointer>
+#include <QDateTime>
+#include <QWaitCondition>
+
+#include "JSON/ScriptParser.h"
+
+namespace JSON
+{
+/**
+ * @class JSON::ParserPool
+ * @brief Runs the frame parser code on several threads at once.
+ *
+ * Projects whose @c parse() function is stateless (i.e. the result only
+ * depends on the frame that is being parsed) can have their frames parsed in
+ * parallel. The pool loads the same parser code into one JSON::ScriptParser
+ * per worker thread and distributes submitted frames round-robin, tagging each
+ * frame with a sequence number.
+ *
+ * Parsed frames are collected by the pool and handed out by takeResult() in
+ * submission order, the framesParsed() signal is emitted whenever the next
+ * frame in sequence becomes available.
+ *
+ * At most FRAMES_PER_WORKER frames per worker may be in flight (submitted but
+ * not taken yet), which bounds the memory used by queued frames and by
+ * results that wait for a slow worker. The owner checks isFull() before
+ * submitting a frame and applies its backpressure policy when the limit is
+ * reached, using discardOldest() or waitForResult().
+ *
+ * @warning Parsers that keep state between calls (e.g. global variables that
+ *          accumulate partial frames) produce wrong results in this mode, since
+ *          consecutive frames are parsed by different engines.
+ */
+class ParserPool : public QObject
+{
+  Q_OBJECT
+
+signals:
+  void framesParsed();
+
+public:
+  static constexpr int FRAMES_PER_WORKER = 64;
+
+  explicit ParserPool(QObject *parent = nullptr);
+  ~ParserPool();
+
+  [[nodiscard]] bool isFull() const;
+  [[nodiscard]] bool isActive() const;
+  [[nodiscard]] quint64 pendingFrames() const;
+  [[nodiscard]] static int idealWorkerCount();
+
+  void stop();
+  void clear();
+  void start(const int workers, const QString &script,
+             const SerialStudio::DecoderMethod decoder,
+             const QList<QByteArray> &samples = {});
+
+  void submit(const QByteArray &data, const QDateTime &rxDateTime);
+  bool takeResult(QVector<JSON::DatasetValue> &values, QDateTime &rxDateTime);
+
+  void discardOldest();
+  bool waitForResult(const qint64 timeoutMs);
+
+private:
+  [[nodiscard]] bool isObsolete(const quint64 sequence) const;
+  void storeResult(const quint64 sequence, QVector<JSON::DatasetValue> &&values,
+                   const QDateTime &rxDateTime);
+
+private:
+  struct Result
+  {
+    QVector<JSON::DatasetValue> values;
+    QDateTime rxDateTime;
+  };
+
+  int m_nextWorker;
+  quint64 m_nextResult;
+  quint64 m_nextSequence;
+  QByteArray m_scriptHash;
+
+  mutable QMutex m_mutex;
+  QWaitCondition m_resultReady;
+  QHash<quint64, Result> m_results;
+  QVector<QThread *> m_threads;
+  QVector<QPointer<ScriptParser>> m_workers;
+};
+} // namespace JSON
@@ -0,0 +1,350 @@
+/*
+ * Serial Studio
+ * https://serial-studio.com/
+ *
+ * Copyright (C) 2020–2025 Alex Spataru
+ *
+ * This file is dual-licensed:
+ *
+ * - Under the GNU GPLv3 (or later) for builds that exclude Pro modules.
+ * - Under the Serial Studio Commercial License for builds that include
+ *   any Pro functionality.
+ *
+ * You must comply with the terms of one of these licenses, depending
+ * on your use case.
+ *
+ * For GPL terms, see <https://www.gnu.org/licenses/gpl-3.0.html>
+ * For commercial terms, see LICENSE_COMMERCIAL.md in the project root.
+ *
+ * SPDX-License-Identifier: GPL-3.0-only OR LicenseRef-SerialStudio-Commercial
+ */
+
+#include "JSON/ParserProfiler.h"
+
+#include <bit>
+#include <cmath>
+
+#include <QFile>
+#include <QFileDialog>
+#include <QTextStream>
+
+#include "Misc/Utilities.h"
+#include "Misc/TimerEvents.h"
+#include "Misc/WorkspaceManager.h"
+
+//------------------------------------------------------------------------------
+// Constructor & singleton access functions
+//------------------------------------------------------------------------------
+
+/**
+ * @brief Constructs the profiler and starts updating the statistics at 1 Hz.
+ */
+JSON::ParserProfiler::ParserProfiler()
+{
+  reset();
+  connect(&Misc::TimerEvents::instance(), &Misc::TimerEvents::timeout1Hz, this,
+          &JSON::ParserProfiler::updateStatistics);
+}
+
+/**
+ * @brief Returns the only instance of the class.
+ */
+JSON::ParserProfiler &JSON::ParserProfiler::instance()
+{
+  static ParserProfiler singleton;
+  return singleton;
+}
+
+//------------------------------------------------------------------------------
+// Statistics access functions
+//------------------------------------------------------------------------------
+
+/**
+ * @brief Returns the number of parser calls during the last second.
+ */
+double JSON::ParserProfiler::callsPerSecond() const
+{
+  return m_callsPerSecond;
+}
+
+/**
+ * @brief Returns the median latency of a parser call, in microseconds.
+ */
+double JSON::ParserProfiler::p50Latency() const
+{
+  return m_p50Latency;
+}
+
+/**
+ * @brief Returns the 99th percentile latency of a parser call, in microseconds.
+ */
+double JSON::ParserProfiler::p99Latency() const
+{
+  return m_p99Latency;
+}
+
+/**
+ * @brief Returns the slowest parser call of the last second, in microseconds.
+ */
+double JSON::ParserProfiler::maxLatency() const
+{
+  return m_maxLatency;
+}
+
+/**
+ * @brief Returns the time spent collecting JavaScript garbage during the last
+ *        second, in milliseconds.
+ */
+double JSON::ParserProfiler::gcPause() const
+{
+  return m_gcPause;
+}
+
+/**
+ * @brief Returns the share of the last second spent running parser code and
+ *        collecting its garbage, in percent.
+ */
+double JSON::ParserProfiler::budgetUsage() const
+{
+  return m_budgetUsage;
+}
+
+//------------------------------------------------------------------------------
+// Hotpath recording functions
+//------------------------------------------------------------------------------
+
+/**
+ * @brief Records the duration of a call to a @c parse() function.
+ *
+ * @param nanoseconds Time spent in the call, including the conversion of the
+ *                    arguments and of the returned values.
+ */
+void JSON::ParserProfiler::recordCall(const qint64 nanoseconds)
+{
+  const auto ns = static_cast<quint64>(qMax<qint64>(0, nanoseconds));
+  m_window[bucketIndex(ns)].fetch_add(1, std::memory_order_relaxed);
+  m_windowCalls.fetch_add(1, std::memory_order_relaxed);
+  m_windowBusyTime.fetch_add(ns, std::memory_order_relaxed);
+
+  auto max = m_windowMaxLatency.load(std::memory_order_relaxed);
+  while (ns > max
+         && !m_windowMaxLatency.compare_exchange_weak(
+             max, ns, std::memory_order_relaxed))
+    ;
+}
+
+/**
+ * @brief Records the duration of a JavaScript garbage collection pause.
+ *
+ * @param nanoseconds Time spent collecting garbage.
+ */
+void JSON::ParserProfiler::recordGarbageCollection(const qint64 nanoseconds)
+{
+  const auto ns = static_cast<quint64>(qMax<qint64>(0, nanoseconds));
+  m_windowGcTime.fetch_add(ns, std::memory_order_relaxed);
+  m_windowGcCount.fetch_add(1, std::memory_order_relaxed);
+}
+
+//------------------------------------------------------------------------------
+// Public slots
+//------------------------------------------------------------------------------
+
+/**
+ * @brief Discards all recorded calls and resets the statistics.
+ */
+void JSON::ParserProfiler::reset()
+{
+  for (auto &bucket : m_window)
+    bucket.store(0, std::memory_order_relaxed);
+
+  m_windowCalls.store(0, std::memory_order_relaxed);
+  m_windowBusyTime.store(0, std::memory_order_relaxed);
+  m_windowMaxLatency.store(0, std::memory_order_relaxed);
+  m_windowGcTime.store(0, std::memory_order_relaxed);
+  m_windowGcCount.store(0, std::memory_order_relaxed);
+  m_windowTimer.start();
+
+  m_callsPerSecond = 0;
+  m_p50Latency = 0;
+  m_p99Latency = 0;
+  m_maxLatency = 0;
+  m_gcPause = 0;
+  m_budgetUsage = 0;
+
+  m_total.fill(0);
+  m_totalCalls = 0;
+  m_totalBusyTime = 0;
+  m_totalMaxLatency = 0;
+  m_totalGcTime = 0;
+  m_totalGcCount = 0;
+  m_totalElapsedTime = 0;
+
+  Q_EMIT statisticsChanged();
+}
+
+/**
+ * @brief Lets the user save the cumulative parser statistics as a CSV file.
+ *
+ * The file contains a summary of all calls recorded since the last reset,
+ * followed by the latency histogram (upper bound of each bucket and number of
+ * calls that fell into it).
+ */
+void JSON::ParserProfiler::exportReport()
+{
+  // Get file save path
+  const auto dir = Misc::WorkspaceManager::instance().path("Profiles");
+  const auto path = QFileDialog::getSaveFileName(
+      nullptr, tr("Export Parser Profile"), dir + "/parser-profile.csv",
+      "*.csv");
+  if (path.isEmpty())
+    return;
+
+  // Open file for writing
+  QFile file(path);
+  if (!file.open(QFile::WriteOnly | QFile::Text))
+  {
+    Misc::Utilities::showMessageBox(tr("File open error"), file.errorString(),
+                                    QMessageBox::Critical);
+    return;
+  }
+
+  // Write summary
+  const auto seconds = qMax(1e-9, m_totalElapsedTime / 1e9);
+  QTextStream stream(&file);
+  stream << "Metric,Value\n";
+  stream << "Calls," << m_totalCalls << '\n';
+  stream << "Calls per second," << m_totalCalls / seconds << '\n';
+  stream << "p50 latency (us),"
+         << percentile(m_total, m_totalCalls, 0.50) / 1e3 << '\n';
+  stream << "p99 latency (us),"
+         << percentile(m_total, m_totalCalls, 0.99) / 1e3 << '\n';
+  stream << "Max latency (us)," << m_totalMaxLatency / 1e3 << '\n';
+  stream << "GC pauses," << m_totalGcCount << '\n';
+  stream << "GC time (ms)," << m_totalGcTime / 1e6 << '\n';
+  stream << "Budget usage (%),"
+         << (m_totalBusyTime + m_totalGcTime) / 1e7 / seconds << '\n';
+
+  // Write histogram
+  stream << '\n' << "Latency upper bound (us),Calls\n";
+  for (int i = 0; i < BUCKET_COUNT; ++i)
+  {
+    if (m_total[i] > 0)
+      stream << bucketUpperBound(i) / 1e3 << ',' << m_total[i] << '\n';
+  }
+
+  stream.flush();
+  file.close();
+}
+
+//------------------------------------------------------------------------------
+// Private slots
+//------------------------------------------------------------------------------
+
+/**
+ * @brief Folds the calls recorded during the last second into the statistics.
+ */
+void JSON::ParserProfiler::updateStatistics()
+{
+  // Take the histogram of the last window
+  Histogram window;
+  for (int i = 0; i < BUCKET_COUNT; ++i)
+  {
+    window[i] = m_window[i].exchange(0, std::memory_order_relaxed);
+    m_total[i] += window[i];
+  }
+
+  const auto calls = m_windowCalls.exchange(0, std::memory_order_relaxed);
+  const auto busy = m_windowBusyTime.exchange(0, std::memory_order_relaxed);
+  const auto max = m_windowMaxLatency.exchange(0, std::memory_order_relaxed);
+  const auto gcTime = m_windowGcTime.exchange(0, std::memory_order_relaxed);
+  const auto gcCount = m_windowGcCount.exchange(0, std::memory_order_relaxed);
+  const auto elapsed = qMax<qint64>(1, m_windowTimer.nsecsElapsed());
+  m_windowTimer.restart();
+
+  // Update cumulative statistics
+  m_totalCalls += calls;
+  m_totalBusyTime += busy;
+  m_totalGcTime += gcTime;
+  m_totalGcCount += gcCount;
+  m_totalElapsedTime += elapsed;
+  m_totalMaxLatency = qMax(m_totalMaxLatency, max);
+
+  // Nothing changed, avoid redrawing the user interface
+  if (calls == 0 && gcCount == 0 && m_callsPerSecond == 0)
+    return;
+
+  // Update reported statistics
+  m_callsPerSecond = calls * 1e9 / elapsed;
+  m_p50Latency = percentile(window, calls, 0.50) / 1e3;
+  m_p99Latency = percentile(window, calls, 0.99) / 1e3;
+  m_maxLatency = max / 1e3;
+  m_gcPause = gcTime / 1e6;
+  m_budgetUsage = (busy + gcTime) * 100.0 / elapsed;
+  Q_EMIT statisticsChanged();
+}
+
+//------------------------------------------------------------------------------
+// Histogram functions
+//------------------------------------------------------------------------------
+
+/**
+ * @brief Returns the histogram bucket for a call that took @a nanoseconds.
+ *
+ * Durations under 4 ns get a bucket each, every power of two above that is
+ * split into four buckets, which bounds the error of the reported percentiles
+ * to 25% while covering any possible duration with 256 buckets.
+ */
+int JSON::ParserProfiler::bucketIndex(const quint64 nanoseconds)
+{
+  if (nanoseconds < 4)
+    return static_cast<int>(nanoseconds);
+
+  const int msb = std::bit_width(nanoseconds) - 1;
+  const int sub = static_cast<int>((nanoseconds >> (msb - 2)) & 3);
+  return 4 + (msb - 2) * 4 + sub;
+}
+
+/**
+ * @brief Returns the longest duration, in nanoseconds, that falls into the
+ *        bucket with the given @a index.
+ */
+quint64 JSON::ParserProfiler::bucketUpperBound(const int index)
+{
+  if (index < 4)
+    return static_cast<quint64>(index);
+
+  const int msb = (index - 4) / 4 + 2;
+  const quint64 sub = static_cast<quint64>((index - 4) % 4);
+  const quint64 lower = (4 + sub) << (msb - 2);
+  return lower + (quint64(1) << (msb - 2)) - 1;
+}
+
+/**
+ * @brief Estimates a percentile of the call durations in @a histogram.
+ *
+ * @param histogram Number of calls per bucket.
+ * @param count     Total number of calls in the histogram.
+ * @param fraction  Percentile to obtain, between 0 and 1.
+ *
+ * @return Upper bound of the bucket that contains the percentile, in
+ *         nanoseconds (0 if the histogram is empty).
+ */
+double JSON::ParserProfiler::percentile(const Histogram &histogram,
+                                        const quint64 count,
+                                        const double fraction)
+{
+  if (count == 0)
+    return 0;
+
+  const auto target = qMax<quint64>(1, std::ceil(count * fraction));
+
+  quint64 accumulated = 0;
+  for (int i = 0; i < BUCKET_COUNT; ++i)
+  {
+    accumulated += histogram[i];
+    if (accumulated >= target)
+      return static_cast<double>(bucketUpperBound(i));
+  }
+
+  return static_cast<double>(bucketUpperBound(BUCKET_COUNT - 1));
+}
@@ -0,0 +1,142 @@
+/*
+ * Serial Studio
+ * https://serial-studio.com/
+ *
+ * Copyright (C) 2020–2025 Alex Spataru
+ *
+ * This file is dual-licensed:
+ *
+ * - Under the GNU GPLv3 (or later) for builds that exclude Pro modules.
+ * - Under the Serial Studio Commercial License for builds that include
+ *   any Pro functionality.
+ *
+ * You must comply with the terms of one of these licenses, depending
+ * on your use case.
+ *
+ * For GPL terms, see <https://www.gnu.org/licenses/gpl-3.0.html>
+ * For commercial terms, see LICENSE_COMMERCIAL.md in the project root.
+ *
+ * SPDX-License-Identifier: GPL-3.0-only OR LicenseRef-SerialStudio-Commercial
+ */
+
+#pragma once
+
+#include <array>
+#include <atomic>
+
+#include <QObject>
+#include <QElapsedTimer>
+
+namespace JSON
+{
+/**
+ * @class JSON::ParserProfiler
+ * @brief Measures how much time is spent running the frame parser code.
+ *
+ * Every call to a JavaScript @c parse() function (in the GUI thread, in the
+ * frame pipeline or in a parser pool worker) is timed and recorded in a
+ * logarithmic latency histogram, along with the pauses caused by collecting
+ * the garbage of each JavaScript engine.
+ *
+ * Recording only performs relaxed atomic operations, so it is safe to record
+ * calls and garbage collections from any thread. Once per second, the GUI
+ * thread folds the histogram of the last second into the reported statistics:
+ *
+ * - Calls per second.
+ * - Median (p50), 99th percentile (p99) and maximum latency of a call.
+ * - Time spent collecting garbage during the last second, by all engines.
+ * - Budget usage: share of the last second spent running parser code
+ *   (values over 100% mean that several threads were parsing at once).
+ *
+ * The cumulative histogram can be exported to a CSV file with exportReport().
+ */
+class ParserProfiler : public QObject
+{
+  // clang-format off
+  Q_OBJECT
+  Q_PROPERTY(double callsPerSecond
+             READ callsPerSecond
+             NOTIFY statisticsChanged)
+  Q_PROPERTY(double p50Latency
+             READ p50Latency
+             NOTIFY statisticsChanged)
+  Q_PROPERTY(double p99Latency
+             READ p99Latency
+             NOTIFY statisticsChanged)
+  Q_PROPERTY(double maxLatency
+             READ maxLatency
+             NOTIFY statisticsChanged)
+  Q_PROPERTY(double gcPause
+             READ gcPause
+             NOTIFY statisticsChanged)
+  Q_PROPERTY(double budgetUsage
+             READ budgetUsage
+             NOTIFY statisticsChanged)
+  // clang-format on
+
+signals:
+  void statisticsChanged();
+
+private:
+  explicit ParserProfiler();
+  ParserProfiler(ParserProfiler &&) = delete;
+  ParserProfiler(const ParserProfiler &) = delete;
+  ParserProfiler &operator=(ParserProfiler &&) = delete;
+  ParserProfiler &operator=(const ParserProfiler &) = delete;
+
+public:
+  static ParserProfiler &instance();
+
+  [[nodiscard]] double callsPerSecond() const;
+  [[nodiscard]] double p50Latency() const;
+  [[nodiscard]] double p99Latency() const;
+  [[nodiscard]] double maxLatency() const;
+  [[nodiscard]] double gcPause() const;
+  [[nodiscard]] double budgetUsage() const;
+
+  void recordCall(const qint64 nanoseconds);
+  void recordGarbageCollection(const qint64 nanoseconds);
+
+public slots:
+  void reset();
+  void exportReport();
+
+private slots:
+  void updateStatistics();
+
+private:
+  static constexpr int BUCKET_COUNT = 256;
+  using Histogram = std::array<quint64, BUCKET_COUNT>;
+
+  [[nodiscard]] static int bucketIndex(const quint64 nanoseconds);
+  [[nodiscard]] static quint64 bucketUpperBound(const int index);
+  [[nodiscard]] static double percentile(const Histogram &histogram,
+                                         const quint64 count,
+                                         const double fraction);
+
+private:
+  std::array<std::atomic<quint64>, BUCKET_COUNT> m_window;
+  std::atomic<quint64> m_windowCalls;
+  std::atomic<quint64> m_windowBusyTime;
+  std::atomic<quint64> m_windowMaxLatency;
+  std::atomic<quint64> m_windowGcTime;
+  std::atomic<quint64> m_windowGcCount;
+
+  QElapsedTimer m_windowTimer;
+
+  double m_callsPerSecond;
+  double m_p50Latency;
+  double m_p99Latency;
+  double m_maxLatency;
+  double m_gcPause;
+  double m_budgetUsage;
+
+  Histogram m_total;
+  quint64 m_totalCalls;
+  quint64 m_totalBusyTime;
+  quint64 m_totalMaxLatency;
+  quint64 m_totalGcTime;
+  quint64 m_totalGcCount;
+  qint64 m_totalElapsedTime;
+};
+} // namespace JSON
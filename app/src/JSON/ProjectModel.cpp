@@ -65,7 +65,8 @@ typedef enum
   kProjectView_FrameDecoder,        /**< Represents the frame decoder item */
   kProjectView_HexadecimalSequence, /**< Represents the frame sequence format */
   kProjectView_FrameDetection,      /**< Represents the frame detection item */
-  kProjectView_ChecksumFunction     /**< Represents the frame checksum item */
+  kProjectView_ChecksumFunction,    /**< Represents the frame checksum item */
+  kProjectView_StatelessParser      /**< Represents the stateless parser item */
 } ProjectItem;
 // clang-format on
 
@@ -141,6 +142,7 @@ JSON::ProjectModel::ProjectModel()
   , m_frameEndSequence("")
   , m_frameStartSequence("")
   , m_hexadecimalDelimiters(false)
+  , m_statelessParser(false)
   , m_currentView(ProjectView)
   , m_frameDecoder(SerialStudio::PlainText)
   , m_frameDetection(SerialStudio::EndDelimiterOnly)
@@ -437,6 +439,19 @@ const QString &JSON::ProjectModel::frameParserCode() const
   return m_frameParserCode;
 }
 
+/**
+ * @brief Returns @c true if the frame parser code of the project keeps no
+ *        state between calls.
+ *
+ * Stateless parsers may be warmed up with sample frames before a device is
+ * connected, and may run on several threads at once when threaded frame
+ * parsing is enabled.
+ */
+bool JSON::ProjectModel::statelessParser() const
+{
+  return m_statelessParser;
+}
+
 /**
  * @brief Determines whether the currently selected group is editable.
  *
@@ -762,11 +777,16 @@ bool JSON::ProjectModel::saveJsonFile(const bool askPath)
   json.insert("decoder", m_frameDecoder);
   json.insert("frameEnd", m_frameEndSequence);
   json.insert("frameParser", m_frameParserCode);
+  json.insert("statelessParser", m_statelessParser);
   json.insert("checksum", m_checksumAlgorithm);
   json.insert("frameDetection", m_frameDetection);
   json.insert("frameStart", m_frameStartSequence);
   json.insert("hexadecimalDelimiters", m_hexadecimalDelimiters);
 
+  // Preserve the native binary frame layout
+  if (!m_binaryLayout.isEmpty())
+    json.insert("binaryLayout", m_binaryLayout);
+
   // Create group array
   QJsonArray groupArray;
   for (const auto &group : std::as_const(m_groups))
@@ -868,6 +888,8 @@ void JSON::ProjectModel::newJsonFile()
   m_checksumAlgorithm = "";
   m_frameStartSequence = "$";
   m_hexadecimalDelimiters = false;
+  m_statelessParser = false;
+  m_binaryLayout = QJsonArray();
   m_title = tr("Untitled Project");
   m_frameParserCode = JSON::FrameParser::defaultCode();
 
@@ -966,8 +988,10 @@ void JSON::ProjectModel::openJsonFile(const QString &path)
   m_frameEndSequence = json.value("frameEnd").toString();
   m_checksumAlgorithm = json.value("checksum").toString();
   m_frameParserCode = json.value("frameParser").toString();
+  m_statelessParser = json.value("statelessParser").toBool();
   m_frameStartSequence = json.value("frameStart").toString();
   m_hexadecimalDelimiters = json.value("hexadecimalDelimiters").toBool();
+  m_binaryLayout = json.value("binaryLayout").toArray();
   m_frameDecoder
       = static_cast<SerialStudio::DecoderMethod>(json.value("decoder").toInt());
   m_frameDetection = static_cast<SerialStudio::FrameDetection>(
@@ -1005,6 +1029,25 @@ void JSON::ProjectModel::openJsonFile(const QString &path)
   // Reset modified flag
   setModified(false);
 
+  // Warn about binary layouts that cannot be decoded natively, there is no
+  // layout editor, so the user has to fix the project file by hand
+  if (!m_binaryLayout.isEmpty())
+  {
+    qsizetype field = -1;
+    JSON::BinaryDecoder decoder;
+    if (!decoder.read(m_binaryLayout, &field))
+    {
+      Misc::Utilities::showMessageBox(
+          tr("Invalid binary layout"),
+          tr("Field %1 of the binary layout of this project is not valid. "
+             "Frames will be decoded by the frame parser function instead. "
+             "Edit the \"binaryLayout\" array of the project file to fix "
+             "it.")
+              .arg(field + 1),
+          QMessageBox::Warning);
+    }
+  }
+
   // Detect legacy frame parser function
   if (json.contains("separator"))
   {
@@ -2289,6 +2332,20 @@ void JSON::ProjectModel::buildProjectModel()
                     ParameterIcon);
   m_projectModel->appendRow(checksum);
 
+  // Add stateless parser flag
+  auto stateless = new QStandardItem();
+  stateless->setEditable(true);
+  stateless->setData(CheckBox, WidgetType);
+  stateless->setData(m_statelessParser, EditableValue);
+  stateless->setData(tr("Stateless Frame Parser"), ParameterName);
+  stateless->setData(kProjectView_StatelessParser, ParameterType);
+  stateless->setData(tr("Parser keeps no state, frames may be parsed in "
+                        "parallel"),
+                     ParameterDescription);
+  stateless->setData("qrc:/rcc/icons/project-editor/model/data-conversion.svg",
+                     ParameterIcon);
+  m_projectModel->appendRow(stateless);
+
   // Handle edits
   connect(m_projectModel, &CustomModel::itemChanged, this,
           &JSON::ProjectModel::onProjectItemChanged);
@@ -3264,6 +3321,9 @@ void JSON::ProjectModel::onProjectItemChanged(QStandardItem *item)
     case kProjectView_ChecksumFunction:
       m_checksumAlgorithm = IO::availableChecksums()[value.toInt()];
       break;
+    case kProjectView_StatelessParser:
+      m_statelessParser = value.toBool();
+      break;
     case kProjectView_HexadecimalSequence: {
       bool changed = m_hexadecimalDelimiters != value.toBool();
       m_hexadecimalDelimiters = value.toBool();
@@ -22,6 +22,7 @@
 #pragma once
 
 #include <QObject>
+#include <QJsonArray>
 #include <QStandardItemModel>
 #include <QItemSelectionModel>
 
@@ -229,6 +230,7 @@ public:
   [[nodiscard]] const QString &title() const;
   [[nodiscard]] const QString &jsonFilePath() const;
   [[nodiscard]] const QString &frameParserCode() const;
+  [[nodiscard]] bool statelessParser() const;
 
   [[nodiscard]] bool currentGroupIsEditable() const;
   [[nodiscard]] bool currentDatasetIsEditable() const;
@@ -312,6 +314,8 @@ private:
   QString m_checksumAlgorithm;
   QString m_frameStartSequence;
   bool m_hexadecimalDelimiters;
+  bool m_statelessParser;
+  QJsonArray m_binaryLayout;
 
   CurrentView m_currentView;
   SerialStudio::DecoderMethod m_frameDecoder;
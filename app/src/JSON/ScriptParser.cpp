@@ -0,0 +1,333 @@
+/*
+ * Serial Studio
+ * https://serial-studio.com/
+ *
+ * Copyright (C) 2020–2025 Alex Spataru
+ *
+ * This file is dual-licensed:
+ *
+ * - Under the GNU GPLv3 (or later) for builds that exclude Pro modules.
+ * - Under the Serial Studio Commercial License for builds that include
+ *   any Pro functionality.
+ *
+ * You must comply with the terms of one of these licenses, depending
+ * on your use case.
+ *
+ * For GPL terms, see <https://www.gnu.org/licenses/gpl-3.0.html>
+ * For commercial terms, see LICENSE_COMMERCIAL.md in the project root.
+ *
+ * SPDX-License-Identifier: GPL-3.0-only OR LicenseRef-SerialStudio-Commercial
+ */
+
+#include <QLocale>
+#include <QElapsedTimer>
+#include <QCryptographicHash>
+
+#include "JSON/ScriptParser.h"
+#include "JSON/ParserProfiler.h"
+
+//------------------------------------------------------------------------------
+// Constructor function
+//------------------------------------------------------------------------------
+
+/**
+ * @brief Constructs a script parser without any parser code loaded.
+ *
+ * @param parent The parent QObject (optional).
+ */
+JSON::ScriptParser::ScriptParser(QObject *parent)
+  : QObject(parent)
+  , m_decoder(SerialStudio::PlainText)
+  , m_engine(nullptr)
+{
+}
+
+//------------------------------------------------------------------------------
+// State access & configuration
+//------------------------------------------------------------------------------
+
+/**
+ * @brief Returns @c true if the loaded code defines a callable @c parse().
+ */
+bool JSON::ScriptParser::isLoaded() const
+{
+  return m_parseFunction.isCallable();
+}
+
+/**
+ * @brief Returns a stable identifier for a frame parser code & decoder pair.
+ *
+ * Used to recognize code that is already loaded, and to store recorded sample
+ * frames for warming up the parser of a project.
+ */
+QByteArray JSON::ScriptParser::scriptHash(
+    const QString &script, const SerialStudio::DecoderMethod decoder)
+{
+  QCryptographicHash hash(QCryptographicHash::Sha1);
+  hash.addData(script.toUtf8());
+  hash.addData(QByteArray::number(static_cast<int>(decoder)));
+  return hash.result().toHex();
+}
+
+/**
+ * @brief Unloads the parser code and destroys the JavaScript engine.
+ */
+void JSON::ScriptParser::reset()
+{
+  m_scriptHash.clear();
+  m_uint8Array = QJSValue();
+  m_parseFunction = QJSValue();
+
+  if (m_engine)
+  {
+    m_engine->deleteLater();
+    m_engine = nullptr;
+  }
+}
+
+/**
+ * @brief Loads the frame parser code into a new JavaScript engine.
+ *
+ * Errors are only logged, since the user is already notified about them by
+ * JSON::FrameParser when the code is edited or the project is loaded.
+ *
+ * If the same stateless code is already loaded with the same decoder, the
+ * engine is kept as is. Otherwise, the code is evaluated in a new engine,
+ * which resets the global variables of stateful parsers, and warmed up with
+ * @a samples, without recording the warm-up calls in JSON::ParserProfiler.
+ *
+ * @param script    Frame parser code of the project.
+ * @param decoder   Decoding method applied to raw frames before parsing them.
+ * @param stateless Whether the project declares the parser as stateless.
+ * @param samples   Raw frames used to warm up the parser, must be empty unless
+ *                  the parser is stateless.
+ *
+ * @return @c true if the code defines a callable @c parse() function.
+ */
+bool JSON::ScriptParser::load(const QString &script,
+                              const SerialStudio::DecoderMethod decoder,
+                              const bool stateless,
+                              const QList<QByteArray> &samples)
+{
+  // Keep the warmed-up engine if the code did not change & keeps no state
+  const auto hash = scriptHash(script, decoder);
+  if (stateless && isLoaded() && hash == m_scriptHash)
+    return true;
+
+  // Create a fresh engine in the calling thread
+  reset();
+  m_decoder = decoder;
+  m_engine = new QJSEngine(this);
+  m_engine->installExtensions(QJSEngine::AllExtensions);
+
+  // Evaluate the script & obtain the parse function
+  QStringList errors;
+  const auto result = m_engine->evaluate(script, "", 1, &errors);
+  if (result.isError())
+    qWarning() << "Script parser:" << result.toString();
+
+  m_uint8Array = m_engine->globalObject().property("Uint8Array");
+  auto fun = m_engine->globalObject().property("parse");
+  if (fun.isCallable())
+    m_parseFunction = fun;
+  else
+  {
+    qWarning() << "Script parser: 'parse' function is not callable";
+    return false;
+  }
+
+  // Run the parser until the engine compiles it
+  if (!samples.isEmpty())
+  {
+    for (int i = 0; i < WARMUP_CALLS; ++i)
+      (void)run(samples[i % samples.count()], m_decoder);
+  }
+
+  m_scriptHash = hash;
+  m_gcTimer.start();
+  return true;
+}
+
+//------------------------------------------------------------------------------
+// Frame parsing
+//------------------------------------------------------------------------------
+
+/**
+ * @brief Decodes a raw frame with the decoder given to load() and runs it
+ *        through the @c parse() function.
+ *
+ * @param data Raw frame data.
+ * @return The channel values returned by the parser (empty if no parser code
+ *         is loaded).
+ */
+QVector<JSON::DatasetValue> JSON::ScriptParser::parse(const QByteArray &data)
+{
+  return parse(data, m_decoder);
+}
+
+/**
+ * @brief Decodes a raw frame and runs it through the @c parse() function.
+ *
+ * Hexadecimal and Base64 frames are encoded as text, plain text frames are
+ * decoded as UTF-8 and binary frames are passed as a @c Uint8Array. The
+ * duration of each call is recorded by JSON::ParserProfiler. Once every
+ * GC_INTERVAL_MS, the garbage of the engine is collected after the call and
+ * the pause is recorded as well.
+ *
+ * @param data    Raw frame data.
+ * @param decoder Decoding method of the project.
+ * @return The channel values returned by the parser (empty if no parser code
+ *         is loaded).
+ */
+QVector<JSON::DatasetValue>
+JSON::ScriptParser::parse(const QByteArray &data,
+                          const SerialStudio::DecoderMethod decoder)
+{
+  if (!isLoaded()) [[unlikely]]
+    return {};
+
+  QElapsedTimer timer;
+  timer.start();
+
+  auto channels = run(data, decoder);
+  ParserProfiler::instance().recordCall(timer.nsecsElapsed());
+
+  // Collect JS garbage periodically & measure how long the thread is paused
+  if (m_gcTimer.elapsed() >= GC_INTERVAL_MS) [[unlikely]]
+  {
+    timer.restart();
+    m_engine->collectGarbage();
+    ParserProfiler::instance().recordGarbageCollection(timer.nsecsElapsed());
+    m_gcTimer.restart();
+  }
+
+  return channels;
+}
+
+/**
+ * @brief Converts the value returned by a JS parse() function into channels.
+ *
+ * Arrays and typed arrays (e.g. @c Float64Array) are read element by element:
+ * numbers are stored directly in the numeric slot of each channel and only
+ * formatted for display, strings are parsed as numbers if possible. This
+ * avoids converting numeric results to a QVariant list and to strings, just
+ * to parse them again later on.
+ *
+ * Any other value keeps the previous conversion rules (e.g. a single string
+ * is treated as a single channel).
+ *
+ * @param result The value returned by the parse() function.
+ * @return The channel values, in the order returned by the parser.
+ */
+QVector<JSON::DatasetValue>
+JSON::ScriptParser::readChannels(const QJSValue &result)
+{
+  QVector<JSON::DatasetValue> channels;
+
+  // Read arrays & typed arrays without QVariant round-trips
+  const auto length = result.property(QStringLiteral("length"));
+  if (result.isArray() || (result.isObject() && length.isNumber())) [[likely]]
+  {
+    const auto count = static_cast<quint32>(qMax(0, length.toInt()));
+    channels.resize(count);
+    for (quint32 i = 0; i < count; ++i)
+    {
+      auto &channel = channels[i];
+      const auto element = result.property(i);
+      if (element.isNumber()) [[likely]]
+      {
+        channel.isNumeric = true;
+        channel.numericValue = element.toNumber();
+        channel.value = QString::number(channel.numericValue, 'g',
+                                        QLocale::FloatingPointShortest);
+      }
+
+      else
+      {
+        if (element.isString())
+          channel.value = element.toString();
+        else
+          channel.value = element.toVariant().toString();
+
+        channel.isNumeric
+            = JSON::Dataset::parseNumber(channel.value, channel.numericValue);
+      }
+    }
+
+    return channels;
+  }
+
+  // Convert any other value through QVariant
+  const auto list = result.toVariant().toStringList();
+  channels.resize(list.count());
+  for (int i = 0; i < list.count(); ++i)
+  {
+    channels[i].value = list[i];
+    channels[i].isNumeric
+        = JSON::Dataset::parseNumber(list[i], channels[i].numericValue);
+  }
+
+  return channels;
+}
+
+/**
+ * @brief Decodes a raw frame and calls the @c parse() function, untimed.
+ */
+QVector<JSON::DatasetValue>
+JSON::ScriptParser::run(const QByteArray &data,
+                        const SerialStudio::DecoderMethod decoder)
+{
+  switch (decoder)
+  {
+    case SerialStudio::Hexadecimal:
+      return call(QString::fromUtf8(data.toHex()));
+    case SerialStudio::Base64:
+      return call(QString::fromUtf8(data.toBase64()));
+    case SerialStudio::Binary:
+      return call(data);
+    case SerialStudio::PlainText:
+    default:
+      return call(QString::fromUtf8(data));
+  }
+}
+
+/**
+ * @brief Calls the frame parser function with a string argument.
+ */
+QVector<JSON::DatasetValue> JSON::ScriptParser::call(const QString &frame)
+{
+  QJSValueList args;
+  args << frame;
+
+  return readChannels(m_parseFunction.call(args));
+}
+
+/**
+ * @brief Calls the frame parser function with a @c Uint8Array of the bytes.
+ *
+ * The @c Uint8Array wraps an @c ArrayBuffer created from @a frame, so the
+ * cost of passing the frame does not depend on its size. Parsers can index
+ * the bytes, or use @c frame.buffer with a @c DataView to read multi-byte
+ * fields.
+ */
+QVector<JSON::DatasetValue> JSON::ScriptParser::call(const QByteArray &frame)
+{
+  QJSValueList args;
+  if (m_uint8Array.isCallable()) [[likely]]
+  {
+    const auto buffer = m_engine->toScriptValue(frame);
+    args << m_uint8Array.callAsConstructor({buffer});
+  }
+
+  else
+  {
+    QJSValue jsArray = m_engine->newArray(frame.size());
+    const auto *data = reinterpret_cast<const quint8 *>(frame.constData());
+    for (int i = 0; i < frame.size(); ++i)
+      jsArray.setProperty(i, data[i]);
+
+    args << jsArray;
+  }
+
+  return readChannels(m_parseFunction.call(args));
+}
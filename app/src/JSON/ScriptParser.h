@@ -0,0 +1,96 @@
+/*
+ * Serial Studio
+ * https://serial-studio.com/
+ *
+ * Copyright (C) 2020–2025 Alex Spataru
+ *
+ * This file is dual-licensed:
+ *
+ * - Under the GNU GPLv3 (or later) for builds that exclude Pro modules.
+ * - Under the Serial Studio Commercial License for builds that include
+ *   any Pro functionality.
+ *
+ * You must comply with the terms of one of these licenses, depending
+ * on your use case.
+ *
+ * For GPL terms, see <https://www.gnu.org/licenses/gpl-3.0.html>
+ * For commercial terms, see LICENSE_COMMERCIAL.md in the project root.
+ *
+ * SPDX-License-Identifier: GPL-3.0-only OR LicenseRef-SerialStudio-Commercial
+ */
+
+#pragma once
+
+#include <QObject>
+#include <QJSValue>
+#include <QJSEngine>
+#include <QByteArray>
+#include <QElapsedTimer>
+
+#include "SerialStudio.h"
+#include "JSON/Frame.h"
+
+namespace JSON
+{
+/**
+ * @class JSON::ScriptParser
+ * @brief Runs the frame parser code of a project outside of the GUI thread.
+ *
+ * Owns a JavaScript engine with the frame parser code loaded, decodes raw
+ * frames with the decoding method of the project and returns the channel
+ * values produced by the @c parse() function.
+ *
+ * The engine is created by load(), so that it belongs to the thread that
+ * executes the parser code. Used by JSON::FramePipeline, by the workers of
+ * JSON::ParserPool and by JSON::FrameParser for the GUI thread.
+ *
+ * Freshly loaded code of stateless parsers is warmed up by running @c parse()
+ * over a set of sample frames, so that the JavaScript engine compiles the
+ * parser before the first real frame arrives. Loading the same stateless code
+ * again keeps the warmed-up engine, stateful code is always evaluated again
+ * in a fresh engine so that its global variables start from scratch.
+ *
+ * The garbage of the engine is collected every GC_INTERVAL_MS while frames
+ * are being parsed, like JSON::FrameParser does for the GUI thread engine.
+ */
+class ScriptParser : public QObject
+{
+  Q_OBJECT
+
+public:
+  explicit ScriptParser(QObject *parent = nullptr);
+
+  static constexpr int WARMUP_CALLS = 64;
+  static constexpr qint64 GC_INTERVAL_MS = 1000;
+
+  [[nodiscard]] bool isLoaded() const;
+  [[nodiscard]] static QByteArray
+  scriptHash(const QString &script, const SerialStudio::DecoderMethod decoder);
+
+  void reset();
+  bool load(const QString &script, const SerialStudio::DecoderMethod decoder,
+            const bool stateless, const QList<QByteArray> &samples = {});
+
+  [[nodiscard]] QVector<JSON::DatasetValue> parse(const QByteArray &data);
+  [[nodiscard]] QVector<JSON::DatasetValue>
+  parse(const QByteArray &data, const SerialStudio::DecoderMethod decoder);
+
+  [[nodiscard]] static QVector<JSON::DatasetValue>
+  readChannels(const QJSValue &result);
+
+private:
+  [[nodiscard]] QVector<JSON::DatasetValue>
+  run(const QByteArray &data, const SerialStudio::DecoderMethod decoder);
+  [[nodiscard]] QVector<JSON::DatasetValue> call(const QString &frame);
+  [[nodiscard]] QVector<JSON::DatasetValue> call(const QByteArray &frame);
+
+private:
+  QByteArray m_scriptHash;
+  SerialStudio::DecoderMethod m_decoder;
+
+  QJSEngine *m_engine;
+  QJSValue m_uint8Array;
+  QJSValue m_parseFunction;
+  QElapsedTimer m_gcTimer;
+};
+} // namespace JSON
@@ -0,0 +1,430 @@
+/*
+ * Serial Studio
+ * https://serial-studio.com/
+ *
+ * Copyright (C) 2020–2025 Alex Spataru
+ *
+ * This file is dual-licensed:
+ *
+ * - Under the GNU GPLv3 (or later) for builds that exclude Pro modules.
+ * - Under the Serial Studio Commercial License for builds that include
+ *   any Pro functionality.
+ *
+ * You must comply with the terms of one of these licenses, depending
+ * on your use case.
+ *
+ * For GPL terms, see <https://www.gnu.org/licenses/gpl-3.0.html>
+ * For commercial terms, see LICENSE_COMMERCIAL.md in the project root.
+ *
+ * SPDX-License-Identifier: GPL-3.0-only OR LicenseRef-SerialStudio-Commercial
+ */
+
+#include <cstring>
+
+#include <QHash>
+#include <QVariant>
+#include <QJsonArray>
+#include <QJsonValue>
+#include <QJsonObject>
+#include <QJsonDocument>
+
+#include "JSON/StreamReader.h"
+
+//------------------------------------------------------------------------------
+// Scanner helpers
+//------------------------------------------------------------------------------
+
+namespace
+{
+/**
+ * @brief Object keys that are relevant to locate dataset values.
+ */
+enum class Key
+{
+  Other,
+  Groups,
+  Datasets,
+  Value
+};
+
+/**
+ * @brief Object or array that is currently open in the JSON text.
+ */
+struct Container
+{
+  bool object; ///< @c true for objects, @c false for arrays
+  Key key;     ///< Key under which the container is stored in its parent
+};
+
+/**
+ * @brief Maximum nesting level supported by the scanner, deeper documents are
+ *        always read with JSON::Frame::read().
+ */
+constexpr int MAX_DEPTH = 32;
+
+/**
+ * @brief Identifies the keys used to reach the value of each dataset.
+ */
+Key classifyKey(QByteArrayView key)
+{
+  if (key == "value")
+    return Key::Value;
+  if (key == "datasets")
+    return Key::Datasets;
+  if (key == "groups")
+    return Key::Groups;
+
+  return Key::Other;
+}
+
+/**
+ * @brief Returns @c true for JSON whitespace characters.
+ */
+bool isSpace(const char c)
+{
+  return c == ' ' || c == '\n' || c == '\r' || c == '\t';
+}
+
+/**
+ * @brief Returns @c true for characters that terminate a scalar token.
+ */
+bool isDelimiter(const char c)
+{
+  return isSpace(c) || c == ',' || c == ':' || c == '}' || c == ']'
+         || c == '{' || c == '[' || c == '"';
+}
+
+/**
+ * @brief Checks that a scalar token is a literal or contains only characters
+ *        that may appear in a JSON number.
+ */
+bool isScalar(QByteArrayView token)
+{
+  if (token == "true" || token == "false" || token == "null")
+    return true;
+
+  for (const char c : token)
+  {
+    if (!((c >= '0' && c <= '9') || c == '-' || c == '+' || c == '.'
+          || c == 'e' || c == 'E'))
+      return false;
+  }
+
+  return !token.isEmpty();
+}
+} // namespace
+
+//------------------------------------------------------------------------------
+// Constructor function
+//------------------------------------------------------------------------------
+
+/**
+ * @brief Constructs a reader that has not seen any frame yet.
+ */
+JSON::StreamReader::StreamReader()
+  : m_synced(false)
+  , m_rebuilt(false)
+  , m_shapeHash(0)
+  , m_frameShapeHash(0)
+{
+}
+
+//------------------------------------------------------------------------------
+// Frame reading
+//------------------------------------------------------------------------------
+
+/**
+ * @brief Forgets the shape of the last frame, so that the next frame is read
+ *        completely.
+ */
+void JSON::StreamReader::reset()
+{
+  m_synced = false;
+  m_rebuilt = false;
+  m_shapeHash = 0;
+  m_frameShapeHash = 0;
+  m_tokens.clear();
+  m_record.values.clear();
+}
+
+/**
+ * @brief Returns @c true if the last call to read() rebuilt the frame with
+ *        JSON::Frame::read().
+ *
+ * A rebuilt frame may differ from the previous one in titles, units, widgets
+ * or other properties that JSON::Frame::equalsStructure() does not compare,
+ * so callers must drop the frame structures they cached for it (e.g. for
+ * JSON::FrameRecord::capture()).
+ */
+bool JSON::StreamReader::rebuilt() const
+{
+  return m_rebuilt;
+}
+
+/**
+ * @brief Reads a JSON frame sent by the device into @a frame.
+ *
+ * If the shape of @a data matches the last frame that was read completely,
+ * only the dataset values of @a frame are updated. Otherwise @a frame is
+ * rebuilt with JSON::Frame::read().
+ *
+ * @param data  Raw JSON frame.
+ * @param frame Frame to update, must be the same instance on every call.
+ *
+ * @return @c true if @a frame contains a valid frame with the new data.
+ */
+bool JSON::StreamReader::read(const QByteArray &data, JSON::Frame &frame)
+{
+  // Only update the dataset values if the frame shape did not change
+  const bool scanned = scan(data);
+  if (scanned && m_synced && m_shapeHash == m_frameShapeHash) [[likely]]
+  {
+    m_record.values.resize(m_tokens.size());
+    for (qsizetype i = 0; i < m_tokens.size(); ++i)
+    {
+      auto &v = m_record.values[i];
+      v.value = decodeValue(i);
+      v.isNumeric = JSON::Dataset::parseNumber(v.value, v.numericValue);
+    }
+
+    m_record.applyTo(frame);
+    m_rebuilt = false;
+    return true;
+  }
+
+  // Rebuild the frame structure
+  m_synced = false;
+  m_rebuilt = true;
+  if (!frame.read(QJsonDocument::fromJson(data).object()))
+    return false;
+
+  // Enable fast updates only if every dataset has exactly one value token,
+  // which is not the case if JSON::Frame::read() skipped invalid entries
+  qsizetype datasets = 0;
+  for (const auto &group : frame.groups())
+    datasets += group.datasetCount();
+
+  m_synced = scanned && datasets == m_tokens.size();
+  m_frameShapeHash = m_shapeHash;
+  return true;
+}
+
+//------------------------------------------------------------------------------
+// Streaming scanner
+//------------------------------------------------------------------------------
+
+/**
+ * @brief Scans the JSON text of a frame in a single pass.
+ *
+ * Registers a value token for every object found at @c groups[i].datasets[j]
+ * of the root object, pointing to the contents of its @c value field (if
+ * any), and hashes every other byte of the text into the shape hash. Only the
+ * contents of the values are left out, so the hash changes whenever a title,
+ * unit, widget, index, the layout or even the formatting of the frame changes.
+ *
+ * @param data Raw JSON frame.
+ * @return @c false if the text is not well-formed enough to be scanned.
+ */
+bool JSON::StreamReader::scan(const QByteArray &data)
+{
+  m_tokens.clear();
+
+  int depth = 0;
+  Container stack[MAX_DEPTH];
+  Key key = Key::Other;
+  bool expectKey = false;
+
+  size_t hash = 0;
+  const char *p = data.constData();
+  const char *end = p + data.size();
+  const char *segment = p;
+
+  // Checks if the containers up to @a level match root.groups[i].datasets[j]
+  const auto isDatasetPath = [&stack](const int level) {
+    const Key keys[] = {Key::Other, Key::Groups, Key::Other, Key::Datasets,
+                        Key::Other};
+    for (int i = 0; i < level; ++i)
+    {
+      if (stack[i].object != (i % 2 == 0))
+        return false;
+      if (i % 2 == 1 && stack[i].key != keys[i])
+        return false;
+    }
+
+    return true;
+  };
+
+  // Excludes a value from the shape hash & registers it for its dataset
+  const auto registerValue = [&](const char *begin, const char *finish,
+                                 const bool isString, const bool hasEscapes) {
+    hash = qHashBits(segment, begin - segment, hash);
+    segment = finish;
+    m_tokens.last() = ValueToken{QByteArrayView(begin, finish - begin),
+                                 isString, hasEscapes};
+  };
+
+  while (p < end)
+  {
+    const char c = *p;
+    switch (c)
+    {
+      // Open a new object or array
+      case '{':
+      case '[': {
+        if (depth == MAX_DEPTH) [[unlikely]]
+          return false;
+
+        const bool object = c == '{';
+        if (object && depth == 4 && isDatasetPath(4))
+          m_tokens.append(ValueToken{QByteArrayView(), false, false});
+
+        const bool keyed = depth > 0 && stack[depth - 1].object;
+        stack[depth++] = Container{object, keyed ? key : Key::Other};
+        expectKey = object;
+        key = Key::Other;
+        ++p;
+        break;
+      }
+
+      // Close the current object or array
+      case '}':
+      case ']':
+        if (depth == 0 || stack[depth - 1].object != (c == '}')) [[unlikely]]
+          return false;
+
+        --depth;
+        expectKey = false;
+        key = Key::Other;
+        ++p;
+        break;
+
+      // Move on to the next key or array element
+      case ',':
+        expectKey = depth > 0 && stack[depth - 1].object;
+        key = Key::Other;
+        ++p;
+        break;
+
+      // Object keys & string values
+      case '"': {
+        // Find the closing quote, skipping escaped quotes
+        const char *begin = p + 1;
+        const char *q = begin;
+        while (true)
+        {
+          q = static_cast<const char *>(
+              std::memchr(q, '"', static_cast<size_t>(end - q)));
+          if (!q) [[unlikely]]
+            return false;
+
+          const char *b = q;
+          while (b > begin && *(b - 1) == '\\')
+            --b;
+
+          if ((q - b) % 2 == 0)
+            break;
+
+          ++q;
+        }
+
+        // Register the string as a key or as a dataset value
+        if (expectKey)
+        {
+          key = classifyKey(QByteArrayView(begin, q - begin));
+          expectKey = false;
+        }
+
+        else if (key == Key::Value && depth == 5 && isDatasetPath(5))
+        {
+          const bool escapes = std::memchr(begin, '\\', q - begin) != nullptr;
+          registerValue(begin, q, true, escapes);
+        }
+
+        p = q + 1;
+        break;
+      }
+
+      // Separators & whitespace
+      case ':':
+      case ' ':
+      case '\n':
+      case '\r':
+      case '\t':
+        ++p;
+        break;
+
+      // Numbers & literals
+      default: {
+        const char *q = p;
+        while (q < end && !isDelimiter(*q))
+          ++q;
+
+        if (!isScalar(QByteArrayView(p, q - p))) [[unlikely]]
+          return false;
+
+        if (key == Key::Value && depth == 5 && isDatasetPath(5))
+          registerValue(p, q, false, false);
+
+        p = q;
+        break;
+      }
+    }
+  }
+
+  // Hash the remaining text
+  m_shapeHash = qHashBits(segment, end - segment, hash);
+  return depth == 0;
+}
+
+/**
+ * @brief Converts a value token to the string that JSON::Dataset::read()
+ *        would have obtained for it.
+ *
+ * @param index Index of the value token.
+ * @return The simplified dataset value, or "--.--" if it is empty.
+ */
+QString JSON::StreamReader::decodeValue(const qsizetype index) const
+{
+  QString value;
+  const auto &token = m_tokens[index];
+
+  // Plain strings can be converted directly
+  if (token.isString && !token.hasEscapes) [[likely]]
+    value = QString::fromUtf8(token.text).simplified();
+
+  // Let Qt resolve escape sequences
+  else if (token.isString)
+  {
+    QByteArray json;
+    json.reserve(token.text.size() + 4);
+    json.append("[\"").append(token.text).append("\"]");
+    const auto array = QJsonDocument::fromJson(json).array();
+    if (!array.isEmpty())
+      value = array.first().toString().simplified();
+  }
+
+  // Convert numbers & literals like JSON::Dataset::read() does
+  else if (!token.text.isEmpty())
+  {
+    QJsonValue json;
+    if (token.text == "true")
+      json = true;
+    else if (token.text == "false")
+      json = false;
+    else if (token.text != "null")
+    {
+      double number = 0;
+      if (JSON::Dataset::parseNumber(token.text.data(), token.text.size(),
+                                     number))
+        json = number;
+    }
+
+    value = QVariant(json).toString().simplified();
+  }
+
+  // Use the same placeholder as JSON::Dataset::read() for empty values
+  if (value.isEmpty())
+    value = QStringLiteral("--.--");
+
+  return value;
+}
@@ -0,0 +1,82 @@
+/*
+ * Serial Studio
+ * https://serial-studio.com/
+ *
+ * Copyright (C) 2020–2025 Alex Spataru
+ *
+ * This file is dual-licensed:
+ *
+ * - Under the GNU GPLv3 (or later) for builds that exclude Pro modules.
+ * - Under the Serial Studio Commercial License for builds that include
+ *   any Pro functionality.
+ *
+ * You must comply with the terms of one of these licenses, depending
+ * on your use case.
+ *
+ * For GPL terms, see <https://www.gnu.org/licenses/gpl-3.0.html>
+ * For commercial terms, see LICENSE_COMMERCIAL.md in the project root.
+ *
+ * SPDX-License-Identifier: GPL-3.0-only OR LicenseRef-SerialStudio-Commercial
+ */
+
+#pragma once
+
+#include <QVector>
+#include <QByteArray>
+#include <QByteArrayView>
+
+#include "JSON/Frame.h"
+
+namespace JSON
+{
+/**
+ * @class JSON::StreamReader
+ * @brief Incremental reader for frames sent by devices in JSON format.
+ *
+ * Devices that operate in DeviceSendsJSON mode send the complete frame
+ * structure (groups, datasets, titles, units, widgets...) with every frame,
+ * even though usually only the dataset values change between frames.
+ *
+ * The reader scans the raw JSON text in a single streaming pass, without
+ * building a DOM. It extracts the contents of every "value" field of the
+ * datasets and computes a hash of all other bytes of the frame (the
+ * "shape"). If the shape matches the frame that was last read completely,
+ * only the dataset values of the existing frame are updated. Otherwise, or
+ * if the scan finds anything unexpected, the frame is rebuilt with
+ * JSON::Frame::read().
+ *
+ * @note Each reader must always be used with the same JSON::Frame instance.
+ */
+class StreamReader
+{
+public:
+  StreamReader();
+
+  void reset();
+  [[nodiscard]] bool rebuilt() const;
+  [[nodiscard]] bool read(const QByteArray &data, JSON::Frame &frame);
+
+private:
+  [[nodiscard]] bool scan(const QByteArray &data);
+  [[nodiscard]] QString decodeValue(qsizetype index) const;
+
+private:
+  /**
+   * @brief Location of the "value" field of a dataset within the frame text.
+   */
+  struct ValueToken
+  {
+    QByteArrayView text; ///< Contents of the value, without quotes
+    bool isString;       ///< Whether the value is a JSON string
+    bool hasEscapes;     ///< Whether the string contains escape sequences
+  };
+
+  bool m_synced;
+  bool m_rebuilt;
+  size_t m_shapeHash;
+  size_t m_frameShapeHash;
+
+  QVector<ValueToken> m_tokens;
+  JSON::FrameRecord m_record;
+};
+} // namespace JSON
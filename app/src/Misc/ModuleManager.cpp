@@ -33,6 +33,7 @@
 #include "JSON/Group.h"
 #include "JSON/Dataset.h"
 #include "JSON/FrameParser.h"
+#include "JSON/ParserProfiler.h"
 #include "JSON/ProjectModel.h"
 #include "JSON/FrameBuilder.h"
 
@@ -316,6 +317,7 @@ void Misc::ModuleManager::initializeQmlInterface()
   auto ioNetwork = &IO::Drivers::Network::instance();
   auto frameBuilder = &JSON::FrameBuilder::instance();
   auto projectModel = &JSON::ProjectModel::instance();
+  auto parserProfiler = &JSON::ParserProfiler::instance();
   auto miscTimerEvents = &Misc::TimerEvents::instance();
   auto miscCommonFonts = &Misc::CommonFonts::instance();
   auto ioConsoleExport = &IO::ConsoleExport::instance();
@@ -361,6 +363,7 @@ void Misc::ModuleManager::initializeQmlInterface()
   c->setContextProperty("Cpp_Misc_Translator", miscTranslator);
   c->setContextProperty("Cpp_JSON_ProjectModel", projectModel);
   c->setContextProperty("Cpp_JSON_FrameBuilder", frameBuilder);
+  c->setContextProperty("Cpp_JSON_ParserProfiler", parserProfiler);
   c->setContextProperty("Cpp_Misc_TimerEvents", miscTimerEvents);
   c->setContextProperty("Cpp_Misc_CommonFonts", miscCommonFonts);
   c->setContextProperty("Cpp_IO_ConsoleExport", ioConsoleExport);
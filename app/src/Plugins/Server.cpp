@@ -143,8 +143,8 @@ void Plugins::Server::setEnabled(const bool enabled)
     }
 
     m_sockets.clear();
-    JSON::Frame frame;
-    while (m_pendingFrames.try_dequeue(frame))
+    JSON::FrameRecord record;
+    while (m_pendingFrames.try_dequeue(record))
     {
     }
   }
@@ -190,15 +190,16 @@ void Plugins::Server::hotpathTxData(const QByteArray &data)
 /**
  * @brief Registers a new structured data frame.
  *
- * Appends the frame to an internal buffer that will be transmitted
- * to clients by sendProcessedData().
+ * Appends the frame record to an internal buffer that will be transmitted
+ * to clients by sendProcessedData(). Records share the frame structure, so
+ * only the dataset values are queued.
  *
- * @param frame JSON::Frame object to register.
+ * @param record Frame record to register.
  */
-void Plugins::Server::hotpathTxFrame(const JSON::Frame &frame)
+void Plugins::Server::hotpathTxFrame(const JSON::FrameRecord &record)
 {
   if (enabled())
-    m_pendingFrames.enqueue(frame);
+    m_pendingFrames.enqueue(record);
 }
 
 /**
@@ -270,7 +271,9 @@ void Plugins::Server::acceptConnection()
  * @brief Sends all collected structured data frames to connected clients.
  *
  * Frames are serialized into a compact JSON array and sent to each
- * writable socket. Called periodically (1 Hz) via timer events.
+ * writable socket, together with the frame queue statistics reported by
+ * IO::Manager (enqueued, dropped and peak occupancy), so that plugins can
+ * detect lossy sessions. Called periodically (1 Hz) via timer events.
  */
 void Plugins::Server::sendProcessedData()
 {
@@ -284,13 +287,13 @@ void Plugins::Server::sendProcessedData()
 
   // Create JSON array with frame data
   QJsonArray array;
-  JSON::Frame frame;
-  while (m_pendingFrames.try_dequeue(frame))
+  JSON::FrameRecord record;
+  while (m_pendingFrames.try_dequeue(record))
   {
   }
   {
     QJsonObject object;
-    object.insert(QStringLiteral("data"), frame.serialize());
+    object.insert(QStringLiteral("data"), record.toFrame().serialize());
     array.append(object);
   }
 
@@ -300,6 +303,9 @@ void Plugins::Server::sendProcessedData()
     // Construct QByteArray with data
     QJsonObject object;
     object.insert(QStringLiteral("frames"), array);
+    object.insert(QStringLiteral("queue"),
+                  QJsonObject::fromVariantMap(
+                      IO::Manager::instance().queueStatistics()));
     const QJsonDocument document(object);
     auto json = document.toJson(QJsonDocument::Compact) + "\n";
 
@@ -88,7 +88,7 @@ public slots:
   void removeConnection();
   void setEnabled(const bool enabled);
   void hotpathTxData(const QByteArray &data);
-  void hotpathTxFrame(const JSON::Frame &frame);
+  void hotpathTxFrame(const JSON::FrameRecord &record);
 
 private slots:
   void onDataReceived();
@@ -100,6 +100,6 @@ private:
   bool m_enabled;
   QTcpServer m_server;
   QVector<QTcpSocket *> m_sockets;
-  moodycamel::ReaderWriterQueue<JSON::Frame> m_pendingFrames{2048};
+  moodycamel::ReaderWriterQueue<JSON::FrameRecord> m_pendingFrames{2048};
 };
 } // namespace Plugins
@@ -27,18 +27,31 @@
 #include "JSON/Group.h"
 #include "JSON/Dataset.h"
 #include "IO/FixedQueue.h"
+#include "IO/SummaryQueue.h"
 
 /**
  * @typedef PlotDataX
  * @brief Represents the unique X-axis data points for a plot.
+ *
+ * Keeps a min/max/mean summary pyramid, so that plots can locate the samples
+ * of any window without scanning the whole buffer.
  */
-typedef IO::FixedQueue<double> PlotDataX;
+typedef IO::SummaryQueue PlotDataX;
 
 /**
  * @typedef PlotDataY
  * @brief Represents the Y-axis data points for a single curve.
+ *
+ * Keeps a min/max/mean summary pyramid, so that decimation and range queries
+ * over any window of samples take O(log n) time.
+ */
+typedef IO::SummaryQueue PlotDataY;
+
+/**
+ * @typedef FFTData
+ * @brief Represents the time-domain samples of an FFT plot.
  */
-typedef IO::FixedQueue<double> PlotDataY;
+typedef IO::FixedQueue<double> FFTData;
 
 /**
  * @typedef PlotData3D
@@ -66,11 +79,14 @@ typedef std::vector<PlotDataY> MultiPlotDataY;
  *
  * This type simplifies data processing by tightly coupling the related X and Y
  * data for a plot, ensuring that they are always accessed and managed together.
+ *
+ * Both pointers are read-only views into the time-series store of the
+ * dashboard, which holds a single sample queue per dataset index.
  */
 typedef struct
 {
-  PlotDataX *x; ///< X-axis data (e.g., time or samples)
-  PlotDataY *y; ///< Y-axis data (e.g., sensor readings)
+  const PlotDataX *x; ///< X-axis data (e.g., time or samples)
+  const PlotDataY *y; ///< Y-axis data (e.g., sensor readings)
 } LineSeries;
 
 /**
@@ -81,15 +97,18 @@ typedef struct
  * sensors or variables are plotted against the same time base or domain.
  *
  * - `x`: Pointer to the shared X-axis data (e.g., time).
- * - `y`: A list of Y-axis data vectors, where each entry represents one curve.
+ * - `y`: A list of pointers to Y-axis data, where each entry represents one
+ *   curve.
  *
  * All Y-series are expected to align with the length and indexing of the
- * shared X-axis.
+ * shared X-axis. Like `LineSeries`, the pointers are read-only views into the
+ * time-series store of the dashboard, so curves that are also displayed by
+ * other widgets are not duplicated.
  */
 typedef struct
 {
-  PlotDataX *x;             ///< Shared X-axis data (e.g., time or index)
-  std::vector<PlotDataY> y; ///< Y-axis data for each individual curve
+  const PlotDataX *x;               ///< Shared X-axis data (e.g., index)
+  std::vector<const PlotDataY *> y; ///< Y-axis data for each curve
 } MultiLineSeries;
 
 /**
@@ -23,12 +23,14 @@
 
 #include "IO/Manager.h"
 #include "CSV/Player.h"
+#include "Misc/Translator.h"
 #include "Misc/TimerEvents.h"
 #include "JSON/FrameBuilder.h"
 
 #include "MQTT/Client.h"
 
 #include <QTimer>
+#include <algorithm>
 
 //------------------------------------------------------------------------------
 // Constructor & singleton access
@@ -41,13 +43,12 @@
  */
 UI::Dashboard::Dashboard()
   : m_points(100)
+  , m_plotDecimation(defaultPlotDecimationIndex())
   , m_precision(2)
   , m_widgetCount(0)
   , m_updateRequired(false)
   , m_showActionPanel(true)
   , m_terminalEnabled(false)
-  , m_pltXAxis(100)
-  , m_multipltXAxis(100)
 {
   // clang-format off
   connect(&CSV::Player::instance(), &CSV::Player::openChanged, this, [=, this] { resetData(true); });
@@ -67,9 +68,21 @@ UI::Dashboard::Dashboard()
               resetData(true);
           });
 
+  // Retranslate the list of plot decimation methods
+  connect(&Misc::Translator::instance(), &Misc::Translator::languageChanged,
+          this, &UI::Dashboard::plotDecimationListChanged);
+
   // Update the dashboard widgets at 24 Hz
   connect(&Misc::TimerEvents::instance(), &Misc::TimerEvents::timeout24Hz, this,
           [=, this] {
+            JSON::FrameBuilder::instance().hotpathPublishSnapshots();
+            if (m_series.update())
+            {
+              configureLineSeries();
+              configureMultiLineSeries();
+              m_updateRequired = true;
+            }
+
             if (m_updateRequired)
             {
               m_updateRequired = false;
@@ -265,6 +278,42 @@ int UI::Dashboard::points() const
   return m_points;
 }
 
+/**
+ * @brief Returns the index of the decimation method applied to line plots,
+ *        matching the order of availablePlotDecimations().
+ */
+int UI::Dashboard::plotDecimationIndex() const
+{
+  return m_plotDecimation;
+}
+
+/**
+ * @brief Returns the index of the decimation method used by default, matching
+ *        the order of availablePlotDecimations().
+ */
+int UI::Dashboard::defaultPlotDecimationIndex() const
+{
+  return PlotDecimation::MinMax;
+}
+
+/**
+ * @brief Returns the decimation method applied to line plots when they hold
+ *        more points than they can display.
+ */
+UI::PlotDecimation::Method UI::Dashboard::plotDecimation() const
+{
+  return static_cast<PlotDecimation::Method>(m_plotDecimation);
+}
+
+/**
+ * @brief Returns a list with the translated names of the available plot
+ *        decimation methods.
+ */
+QStringList UI::Dashboard::availablePlotDecimations() const
+{
+  return PlotDecimation::availableMethods();
+}
+
 /**
  * @brief Gets the number of decimal points for the dashboard widgets.
  * @return Current precision level.
@@ -528,9 +577,9 @@ const JSON::Frame &UI::Dashboard::processedFrame()
  * @brief Returns the FFT plot data currently displayed on the dashboard.
  *
  * @param index The widget index for the FFT plot.
- * @return Reference to the corresponding PlotDataY buffer.
+ * @return Reference to the corresponding FFTData buffer.
  */
-const PlotDataY &UI::Dashboard::fftData(const int index) const
+const FFTData &UI::Dashboard::fftData(const int index) const
 {
   return m_fftValues[index];
 }
@@ -600,14 +649,28 @@ void UI::Dashboard::setPoints(const int points)
     m_points = points;
 
     // Update plot data structures
-    configureLineSeries();
-    configureMultiLineSeries();
+    configureChannels();
 
     // Update the UI
     Q_EMIT pointsChanged();
   }
 }
 
+/**
+ * @brief Sets the decimation method applied to line plots.
+ *
+ * @param method Index of the method in availablePlotDecimations().
+ */
+void UI::Dashboard::setPlotDecimation(const int method)
+{
+  const auto value = qBound(0, method, static_cast<int>(PlotDecimation::LTTB));
+  if (m_plotDecimation != value)
+  {
+    m_plotDecimation = value;
+    Q_EMIT plotDecimationChanged();
+  }
+}
+
 /**
  * @brief Sets the precision level for the dashboard, if changed, and emits
  *        the @c precisionChanged signal to update the UI.
@@ -648,16 +711,19 @@ void UI::Dashboard::resetData(const bool notify)
   m_gpsValues.clear();
   m_gpsValues.squeeze();
 
-  // Clear X/Y axis arrays
-  m_xAxisData.clear();
-  m_yAxisData.clear();
+  // Clear the time-series store
+  m_channelIds.clear();
+  m_channelValues.clear();
+  m_channelSources.clear();
+  m_series.configure(m_channelIds, points() + 1);
 
   // Clear widget & action structures
   m_widgetCount = 0;
   m_widgetMap.clear();
   m_widgetGroups.clear();
   m_widgetDatasets.clear();
-  m_datasetReferences.clear();
+  m_datasetSlotOffsets.clear();
+  m_datasetSlotTargets.clear();
 
   // Reset frame data
   m_rawFrame = JSON::Frame();
@@ -829,28 +895,34 @@ void UI::Dashboard::hotpathRxFrame(const JSON::Frame &frame)
  * @brief Updates dataset values and plot data based on the given frame.
  *
  * Iterates through groups and datasets in the frame, updating internal
- * data structures with the latest values.
+ * data structures with the latest values. The frame structure matches the
+ * one used by reconfigureDashboard(), so each dataset is copied to the
+ * references compiled for its position without any map lookups.
  *
  * @param frame The JSON frame containing new dataset values.
  */
 void UI::Dashboard::updateDashboardData(const JSON::Frame &frame)
 {
+  qsizetype slot = 0;
+  const qsizetype slotCount = m_datasetSlotOffsets.size() - 1;
   for (const auto &group : frame.groups())
   {
     for (const auto &dataset : group.datasets())
     {
-      const auto uid = dataset.uniqueId();
-      const auto it = m_datasetReferences.find(uid);
-      if (it == m_datasetReferences.end()) [[unlikely]]
+      if (slot >= slotCount) [[unlikely]]
       {
         resetData(false);
         hotpathRxFrame(frame);
         return;
       }
 
-      const auto &datasets = it.value();
-      for (auto *ptr : datasets)
-        ptr->setValue(dataset.value());
+      const auto begin = m_datasetSlotOffsets[slot];
+      const auto end = m_datasetSlotOffsets[slot + 1];
+      for (auto i = begin; i < end; ++i)
+        m_datasetSlotTargets[i]->setValue(
+            dataset.value(), dataset.numericValue(), dataset.isNumeric());
+
+      ++slot;
     }
   }
 
@@ -989,6 +1061,9 @@ void UI::Dashboard::reconfigureDashboard(const JSON::Frame &frame)
       m_widgetMap.insert(m_widgetCount++, qMakePair(key, j));
   }
 
+  // Maps unique dataset ID to all dataset refs for value updates
+  QMap<quint32, QVector<JSON::Dataset *>> references;
+
   // Traverse all group-level datasets
   for (auto &groupList : m_widgetGroups)
   {
@@ -997,7 +1072,7 @@ void UI::Dashboard::reconfigureDashboard(const JSON::Frame &frame)
       for (auto &dataset : group.m_datasets)
       {
         const quint32 uid = dataset.uniqueId();
-        m_datasetReferences[uid].append(&dataset);
+        references[uid].append(&dataset);
       }
     }
   }
@@ -1008,7 +1083,7 @@ void UI::Dashboard::reconfigureDashboard(const JSON::Frame &frame)
     for (auto &dataset : datasetList)
     {
       const quint32 uid = dataset.uniqueId();
-      m_datasetReferences[uid].append(&dataset);
+      references[uid].append(&dataset);
     }
   }
 
@@ -1016,7 +1091,18 @@ void UI::Dashboard::reconfigureDashboard(const JSON::Frame &frame)
   for (auto &dataset : m_datasets)
   {
     const quint32 uid = dataset.uniqueId();
-    m_datasetReferences[uid].append(&dataset);
+    references[uid].append(&dataset);
+  }
+
+  // Compile the refs in the order in which datasets appear in the frame
+  m_datasetSlotOffsets.append(0);
+  for (const auto &group : m_rawFrame.groups())
+  {
+    for (const auto &dataset : group.datasets())
+    {
+      m_datasetSlotTargets.append(references.value(dataset.uniqueId()));
+      m_datasetSlotOffsets.append(m_datasetSlotTargets.size());
+    }
   }
 
   // Initialize data series & update actions
@@ -1050,6 +1136,12 @@ void UI::Dashboard::reconfigureDashboard(const JSON::Frame &frame)
  * - Shifts in the latest sample from the dashboard dataset into the correct
  *   slot of the buffer.
  *
+ * Linear plots and multi-plots share a single time-series store, in which
+ * each dataset has one channel that is shifted once per frame. The values are
+ * handed to the ingestion thread of the store, which updates the summary
+ * pyramid and the sliding-window min/max of each channel, so plot widgets can
+ * autoscale in constant time.
+ *
  * @warning GPS and 3D plots rely on structured dataset groups and expect the
  *          widgets to provide fields like [`lat`, `lon`, `alt`], or
  *          [`x`, `y`, `z`].
@@ -1068,10 +1160,9 @@ void UI::Dashboard::updateDataSeries()
     configureGpsSeries();
   if (m_fftValues.size() != fftCount) [[unlikely]]
     configureFftSeries();
-  if (m_pltValues.size() != plotCount) [[unlikely]]
-    configureLineSeries();
-  if (m_multipltValues.size() != multiCount) [[unlikely]]
-    configureMultiLineSeries();
+  if (m_pltValues.size() != plotCount
+      || m_multipltValues.size() != multiCount) [[unlikely]]
+    configureChannels();
   if (m_plotData3D.size() != plot3DCount) [[unlikely]]
     configurePlot3DSeries();
 
@@ -1085,7 +1176,7 @@ void UI::Dashboard::updateDataSeries()
     for (const auto &dataset : group.datasets())
     {
       const QString &id = dataset.widget();
-      const double val = dataset.value().toDouble();
+      const double val = dataset.numericValue();
 
       if (id == "lat")
         lat = val;
@@ -1104,40 +1195,16 @@ void UI::Dashboard::updateDataSeries()
   for (int i = 0; i < fftCount; ++i)
   {
     const auto &dataset = getDatasetWidget(SerialStudio::DashboardFFT, i);
-    m_fftValues[i].push(dataset.value().toDouble());
+    m_fftValues[i].push(dataset.numericValue());
   }
 
-  // Append latest values to linear plots data
-  QSet<int> xAxesMoved;
-  QSet<int> yAxesMoved;
-  for (int i = 0; i < plotCount; ++i)
-  {
-    // Shift Y-axis points
-    const auto &yDataset = getDatasetWidget(SerialStudio::DashboardPlot, i);
-    if (!yAxesMoved.contains(yDataset.index()))
-    {
-      yAxesMoved.insert(yDataset.index());
-      m_yAxisData[yDataset.index()].push(yDataset.value().toDouble());
-    }
+  // Shift the latest value of each dataset into its channel once, regardless
+  // of how many widgets display it
+  for (qsizetype i = 0; i < m_channelSources.size(); ++i)
+    m_channelValues[i] = m_channelSources[i]->numericValue();
 
-    // Shift X-axis points
-    auto xAxisId = SerialStudio::activated() ? yDataset.xAxisId() : 0;
-    if (m_datasets.contains(xAxisId) && !xAxesMoved.contains(xAxisId))
-    {
-      xAxesMoved.insert(xAxisId);
-      const auto &xDataset = m_datasets[xAxisId];
-      m_xAxisData[xAxisId].push(xDataset.value().toDouble());
-    }
-  }
-
-  // Update Multi-plots
-  for (int i = 0; i < multiCount; ++i)
-  {
-    const auto &group = getGroupWidget(SerialStudio::DashboardMultiPlot, i);
-    auto &multiSeries = m_multipltValues[i];
-    for (int j = 0; j < group.datasetCount(); ++j)
-      multiSeries.y[j].push(group.datasets()[j].value().toDouble());
-  }
+  if (!m_channelIds.isEmpty())
+    m_series.append(m_channelValues);
 
   // Update 3D plots
   for (int i = 0; i < plot3DCount; ++i)
@@ -1149,7 +1216,7 @@ void UI::Dashboard::updateDataSeries()
     for (const auto &dataset : group.datasets())
     {
       const QString &id = dataset.widget();
-      const double val = dataset.value().toDouble();
+      const double val = dataset.numericValue();
       if (id == "x" || id == "X")
         point.setX(val);
       else if (id == "y" || id == "Y")
@@ -1230,94 +1297,125 @@ void UI::Dashboard::configureFftSeries()
   for (int i = 0; i < widgetCount(SerialStudio::DashboardFFT); ++i)
   {
     const auto &dataset = getDatasetWidget(SerialStudio::DashboardFFT, i);
-    m_fftValues.append(PlotDataY(dataset.fftSamples()));
+    m_fftValues.append(FFTData(dataset.fftSamples()));
   }
 }
 
 /**
- * @brief Configures the line series data structure for the dashboard.
+ * @brief Configures the time-series store shared by all plot widgets.
  *
- * This function clears and reinitializes the X-axis and Y-axis data arrays,
- * as well as the plot values structure (`m_pltValues`). It associates each
- * dataset with its respective X and Y data, creating `LineSeries` objects
- * for plotting.
+ * The store holds a single sample queue (channel) for each dataset that is
+ * displayed by a plot, used as the X-axis of a plot, or displayed by a
+ * multi-plot, along with the sample index X-axis shared by all plots. Each
+ * channel is pushed once per frame, no matter how many widgets display it,
+ * and plot widgets obtain read-only views into the store through
+ * `LineSeries` and `MultiLineSeries` structures.
  *
- * - If a dataset specifies an X-axis source, the corresponding data is used.
- * - Otherwise, the default X-axis (based on sample points) is used.
+ * Channels are keyed by the unique ID of their dataset rather than by its
+ * index, since several datasets may share an index (e.g. JSON frames sent by
+ * the device without "index" fields) while showing different values.
  *
- * @note Typically called during dashboard setup or reset to prepare plot
- *       widgets for rendering.
+ * Samples are pushed by the ingestion thread of the store, the GUI thread
+ * only reads the buffer published at the last dashboard update. Until the
+ * new layout is published, views of missing channels are empty.
+ *
+ * @note Typically called during dashboard setup or reset, or when the number
+ *       of plot points changes.
  */
-void UI::Dashboard::configureLineSeries()
+void UI::Dashboard::configureChannels()
 {
   // Clear memory
-  m_xAxisData.clear();
-  m_yAxisData.clear();
   m_pltValues.clear();
   m_pltValues.squeeze();
+  m_multipltValues.clear();
+  m_multipltValues.squeeze();
 
-  // Reset default X-axis data
-  m_pltXAxis = PlotDataX(points() + 1);
-  m_pltXAxis.fillRange(0, 1);
+  // Registers a channel for the given dataset, sorted by unique ID. The
+  // dataset is a widget copy that receives the values of each frame
+  QMap<int, const JSON::Dataset *> channels;
+  const auto registerChannel = [&channels](const JSON::Dataset &dataset) {
+    channels.insert(static_cast<int>(dataset.uniqueId()), &dataset);
+  };
 
-  // Construct X/Y axis data arrays
-  for (auto i = m_widgetDatasets.begin(); i != m_widgetDatasets.end(); ++i)
+  // Register the X/Y-axis channels of each plot
+  for (int i = 0; i < widgetCount(SerialStudio::DashboardPlot); ++i)
   {
-    // Obtain list of datasets for a widget type
-    const auto &datasets = i.value();
+    const auto &yDataset = getDatasetWidget(SerialStudio::DashboardPlot, i);
+    registerChannel(yDataset);
 
-    // Iterate over all the datasets
-    for (auto d = datasets.begin(); d != datasets.end(); ++d)
-    {
-      if (d->graph())
-      {
-        // Register Y-axis
-        PlotDataY yAxis(points() + 1);
-        m_yAxisData.insert(d->index(), yAxis);
-        m_yAxisData[d->index()].fill(0);
+    const auto x = m_datasets.constFind(yDataset.xAxisId());
+    if (x != m_datasets.cend() && SerialStudio::activated())
+      registerChannel(x.value());
+  }
 
-        // Register X-axis
-        if (SerialStudio::activated())
-        {
-          int xSource = d->xAxisId();
-          if (!m_xAxisData.contains(xSource))
-          {
-            PlotDataX xAxis(points() + 1);
-            if (m_datasets.contains(xSource))
-            {
-              m_xAxisData.insert(xSource, xAxis);
-              m_xAxisData[xSource].fill(0);
-            }
-          }
-        }
-      }
-    }
+  // Register the channels of each multi-plot curve
+  for (int i = 0; i < widgetCount(SerialStudio::DashboardMultiPlot); ++i)
+  {
+    const auto &group = getGroupWidget(SerialStudio::DashboardMultiPlot, i);
+    for (const auto &dataset : group.datasets())
+      registerChannel(dataset);
   }
 
+  // Reset the store, zero-filled channels are published by its thread
+  m_channelIds = channels.keys();
+  m_channelSources = channels.values();
+  m_channelValues.resize(m_channelIds.size());
+  m_series.configure(m_channelIds, points() + 1);
+
+  // Generate the views used by the plot widgets
+  configureLineSeries();
+  configureMultiLineSeries();
+}
+
+/**
+ * @brief Configures the line series data structure for the dashboard.
+ *
+ * This function generates the plot values structure (`m_pltValues`), which
+ * associates each plot with its X and Y channels in the time-series store.
+ *
+ * - If a dataset specifies an X-axis source, the corresponding data is used.
+ * - Otherwise, the default X-axis (based on sample points) is used.
+ *
+ * @note Called by configureChannels(), and whenever the store publishes a new
+ *       buffer, since views are only valid until the next buffer is taken.
+ */
+void UI::Dashboard::configureLineSeries()
+{
+  // Clear memory
+  m_pltValues.clear();
+  m_pltValues.squeeze();
+
+  // Obtain the channels published by the store
+  const auto &store = m_series.front();
+  const auto channel = [&](const JSON::Dataset &d) -> const PlotDataY * {
+    const auto it = store.channels.constFind(static_cast<int>(d.uniqueId()));
+    return it != store.channels.constEnd() ? &it.value() : nullptr;
+  };
+
   // Construct plot values structure
   for (int i = 0; i < widgetCount(SerialStudio::DashboardPlot); ++i)
   {
-    // Obtain Y-axis data
+    // Obtain Y-axis data, the store may still use a previous layout
     const auto &yDataset = getDatasetWidget(SerialStudio::DashboardPlot, i);
+    const auto *y = channel(yDataset);
+
+    // Obtain X-axis data from the dataset registered with the X-axis index
+    const PlotDataY *x = nullptr;
+    const auto xDataset = m_datasets.constFind(yDataset.xAxisId());
+    if (xDataset != m_datasets.cend())
+      x = channel(xDataset.value());
 
     // Add X-axis data & generate a line series with X/Y data
-    if (m_datasets.contains(yDataset.xAxisId()) && SerialStudio::activated())
-    {
-      const auto &xDataset = m_datasets[yDataset.xAxisId()];
-      LineSeries series;
-      series.x = &m_xAxisData[xDataset.index()];
-      series.y = &m_yAxisData[yDataset.index()];
-      m_pltValues.append(series);
-    }
+    LineSeries series;
+    series.y = y ? y : &m_missingChannel;
+    if (x && SerialStudio::activated())
+      series.x = x;
 
     // Only use Y-axis data, use samples/points as X-axis
     else
-    {
-      LineSeries series;
-      series.x = &m_pltXAxis;
-      series.y = &m_yAxisData[yDataset.index()];
-      m_pltValues.append(series);
-    }
+      series.x = &store.sampleAxis;
+
+    m_pltValues.append(series);
   }
 }
 
@@ -1350,11 +1448,11 @@ void UI::Dashboard::configurePlot3DSeries()
  * @brief Configures the multi-line series data structure for the dashboard.
  *
  * This function initializes the data structure used for multi-plot widgets.
- * It assigns the default X-axis to all multi-line series and creates a
- * `PlotDataY` vector for each dataset in the group, initializing it with zeros.
+ * It assigns the default X-axis to all multi-line series and references the
+ * channel of each dataset in the group from the time-series store.
  *
- * @note Typically called during dashboard setup or reset to prepare multi-plot
- *       widgets for rendering.
+ * @note Called by configureChannels(), and whenever the store publishes a new
+ *       buffer, since views are only valid until the next buffer is taken.
  */
 void UI::Dashboard::configureMultiLineSeries()
 {
@@ -1362,9 +1460,8 @@ void UI::Dashboard::configureMultiLineSeries()
   m_multipltValues.clear();
   m_multipltValues.squeeze();
 
-  // Reset default X-axis data
-  m_multipltXAxis = PlotDataX(points() + 1);
-  m_multipltXAxis.fillRange(0, 1);
+  // Obtain the channels published by the store
+  const auto &store = m_series.front();
 
   // Construct multi-plot values structure
   for (int i = 0; i < widgetCount(SerialStudio::DashboardMultiPlot); ++i)
@@ -1372,11 +1469,15 @@ void UI::Dashboard::configureMultiLineSeries()
     const auto &group = getGroupWidget(SerialStudio::DashboardMultiPlot, i);
 
     MultiLineSeries series;
-    series.x = &m_multipltXAxis;
-    for (int j = 0; j < group.datasetCount(); ++j)
+    series.x = &store.sampleAxis;
+    for (const auto &dataset : group.datasets())
     {
-      series.y.push_back(PlotDataY(points() + 1));
-      series.y.back().fill(0);
+      const auto id = static_cast<int>(dataset.uniqueId());
+      const auto it = store.channels.constFind(id);
+      if (it != store.channels.constEnd())
+        series.y.push_back(&it.value());
+      else
+        series.y.push_back(&m_missingChannel);
     }
 
     m_multipltValues.append(series);
@@ -26,6 +26,8 @@
 
 #include "JSON/Frame.h"
 #include "SerialStudio.h"
+#include "UI/SeriesStore.h"
+#include "UI/PlotDecimation.h"
 
 namespace UI
 {
@@ -55,6 +57,9 @@ class Dashboard : public QObject
   Q_PROPERTY(bool available READ available NOTIFY widgetCountChanged)
   Q_PROPERTY(int actionCount READ actionCount NOTIFY widgetCountChanged)
   Q_PROPERTY(int points READ points WRITE setPoints NOTIFY pointsChanged)
+  Q_PROPERTY(int plotDecimation READ plotDecimationIndex WRITE setPlotDecimation NOTIFY plotDecimationChanged)
+  Q_PROPERTY(QStringList availablePlotDecimations READ availablePlotDecimations NOTIFY plotDecimationListChanged)
+  Q_PROPERTY(int defaultPlotDecimation READ defaultPlotDecimationIndex CONSTANT)
   Q_PROPERTY(QVariantList actions READ actions NOTIFY actionStatusChanged)
   Q_PROPERTY(int totalWidgetCount READ totalWidgetCount NOTIFY widgetCountChanged)
   Q_PROPERTY(int precision READ precision WRITE setPrecision NOTIFY precisionChanged)
@@ -69,6 +74,8 @@ signals:
   void updated();
   void dataReset();
   void pointsChanged();
+  void plotDecimationChanged();
+  void plotDecimationListChanged();
   void precisionChanged();
   void widgetCountChanged();
   void actionStatusChanged();
@@ -97,6 +104,10 @@ public:
   [[nodiscard]] bool containsCommercialFeatures() const;
 
   [[nodiscard]] int points() const;
+  [[nodiscard]] int plotDecimationIndex() const;
+  [[nodiscard]] int defaultPlotDecimationIndex() const;
+  [[nodiscard]] UI::PlotDecimation::Method plotDecimation() const;
+  [[nodiscard]] QStringList availablePlotDecimations() const;
   [[nodiscard]] int precision() const;
   [[nodiscard]] int actionCount() const;
   [[nodiscard]] int totalWidgetCount() const;
@@ -118,7 +129,7 @@ public:
 
   [[nodiscard]] const JSON::Frame &rawFrame();
   [[nodiscard]] const JSON::Frame &processedFrame();
-  [[nodiscard]] const PlotDataY &fftData(const int index) const;
+  [[nodiscard]] const FFTData &fftData(const int index) const;
   [[nodiscard]] const GpsSeries &gpsSeries(const int index) const;
   [[nodiscard]] const LineSeries &plotData(const int index) const;
   [[nodiscard]] const MultiLineSeries &multiplotData(const int index) const;
@@ -127,6 +138,7 @@ public:
 
 public slots:
   void setPoints(const int points);
+  void setPlotDecimation(const int method);
   void setPrecision(const int precision);
   void resetData(const bool notify = true);
   void setShowActionPanel(const bool enabled);
@@ -141,6 +153,7 @@ private:
 
   void updateDataSeries();
   void configureGpsSeries();
+  void configureChannels();
   void configureFftSeries();
   void configureLineSeries();
   void configurePlot3DSeries();
@@ -149,20 +162,22 @@ private:
 
 private:
   int m_points;           // Number of plot points to retain
+  int m_plotDecimation;   // Decimation method applied to line plots
   int m_precision;        // Decimal display precision
   int m_widgetCount;      // Total number of active widgets
   bool m_updateRequired;  // Flag to trigger plot/UI update
   bool m_showActionPanel; // Whenever the UI shall display an action panel
   bool m_terminalEnabled; // Whether terminal group is enabled
 
-  PlotDataX m_pltXAxis;      // Default X-axis data for line plots
-  PlotDataX m_multipltXAxis; // Default X-axis data for multi-line plots
+  UI::SeriesStore m_series;        // Time-series store shared by all plots
+  QVector<int> m_channelIds;       // Dataset unique ID of each store channel
+  QVector<double> m_channelValues; // Latest value of each store channel
+  PlotDataY m_missingChannel;      // Empty channel for pending layouts
 
-  QMap<int, PlotDataX> m_xAxisData; // X-axis data per dataset index
-  QMap<int, PlotDataY> m_yAxisData; // Y-axis data per dataset index
+  QVector<const JSON::Dataset *> m_channelSources; // Dataset of each channel
 
   QVector<GpsSeries> m_gpsValues;            // GPS data per GPS widget
-  QVector<PlotDataY> m_fftValues;            // FFT data per dataset
+  QVector<FFTData> m_fftValues;              // FFT data per dataset
   QVector<LineSeries> m_pltValues;           // Line plot data
   QVector<MultiLineSeries> m_multipltValues; // Multi-line plot data
   QVector<PlotData3D> m_plotData3D; // 3D plot data (commercial only)
@@ -172,8 +187,10 @@ private:
   SerialStudio::WidgetMap m_widgetMap; // Maps window ID index to widget type
   QMap<int, JSON::Dataset> m_datasets; // Raw input datasets (by dataset index)
 
-  // Maps unique dataset ID to all dataset refs for value updates
-  QMap<quint32, QVector<JSON::Dataset *>> m_datasetReferences;
+  // Flat table of dataset refs to update for each dataset of incoming frames,
+  // the refs of the n-th frame dataset are in [offsets[n], offsets[n + 1])
+  QVector<qsizetype> m_datasetSlotOffsets;
+  QVector<JSON::Dataset *> m_datasetSlotTargets;
 
   // Groups by widgets type
   QMap<SerialStudio::DashboardWidget, QVector<JSON::Group>> m_widgetGroups;
@@ -0,0 +1,290 @@
+/*
+ * Serial Studio
+ * https://serial-studio.com/
+ *
+ * Copyright (C) 2020–2025 Alex Spataru
+ *
+ * This file is dual-licensed:
+ *
+ * - Under the GNU GPLv3 (or later) for builds that exclude Pro modules.
+ * - Under the Serial Studio Commercial License for builds that include
+ *   any Pro functionality.
+ *
+ * You must comply with the terms of one of these licenses, depending
+ * on your use case.
+ *
+ * For GPL terms, see <https://www.gnu.org/licenses/gpl-3.0.html>
+ * For commercial terms, see LICENSE_COMMERCIAL.md in the project root.
+ *
+ * SPDX-License-Identifier: GPL-3.0-only OR LicenseRef-SerialStudio-Commercial
+ */
+
+#include "UI/PlotDecimation.h"
+
+#include <cmath>
+#include <algorithm>
+
+#include <QCoreApplication>
+
+//------------------------------------------------------------------------------
+// Ring buffer access
+//------------------------------------------------------------------------------
+
+/**
+ * @brief Random access to the samples shared by an X and a Y queue.
+ *
+ * Reads the circular buffers of both queues directly, avoiding the bounds
+ * checks and modulo operations of IO::FixedQueue::operator[].
+ */
+struct UI::PlotDecimation::Samples
+{
+  Samples(const PlotDataX &x, const PlotDataY &y)
+    : xData(x.raw())
+    , yData(y.raw())
+    , xFront(x.frontIndex())
+    , yFront(y.frontIndex())
+    , xCapacity(x.capacity())
+    , yCapacity(y.capacity())
+    , count(static_cast<qsizetype>(std::min(x.size(), y.size())))
+  {
+  }
+
+  [[nodiscard]] double x(const qsizetype i) const
+  {
+    auto j = xFront + static_cast<std::size_t>(i);
+    if (j >= xCapacity)
+      j -= xCapacity;
+
+    return xData[j];
+  }
+
+  [[nodiscard]] double y(const qsizetype i) const
+  {
+    auto j = yFront + static_cast<std::size_t>(i);
+    if (j >= yCapacity)
+      j -= yCapacity;
+
+    return yData[j];
+  }
+
+  const double *xData;
+  const double *yData;
+  std::size_t xFront;
+  std::size_t yFront;
+  std::size_t xCapacity;
+  std::size_t yCapacity;
+  qsizetype count;
+};
+
+//------------------------------------------------------------------------------
+// Public functions
+//------------------------------------------------------------------------------
+
+/**
+ * @brief Returns the translated names of the decimation methods, in the order
+ *        of the PlotDecimation::Method enumeration.
+ */
+QStringList UI::PlotDecimation::availableMethods()
+{
+  QStringList list;
+  list.append(QCoreApplication::translate("UI::PlotDecimation", "Disabled"));
+  list.append(QCoreApplication::translate("UI::PlotDecimation",
+                                          "Min/Max per Pixel (M4)"));
+  list.append(QCoreApplication::translate("UI::PlotDecimation",
+                                          "Largest-Triangle-Three-Buckets"));
+  return list;
+}
+
+/**
+ * @brief Copies the samples of @a x and @a y into @a out, decimating them if
+ *        there are more samples than the plot can display.
+ *
+ * @param x      X-axis sample queue.
+ * @param y      Y-axis sample queue.
+ * @param width  Width of the plot area, in pixels (0 if unknown).
+ * @param method Decimation method to apply.
+ * @param out    Receives the points to draw.
+ *
+ * @return Decimation ratio, i.e. number of samples per drawn point (1 if the
+ *         samples were copied in full).
+ */
+double UI::PlotDecimation::decimate(const PlotDataX &x, const PlotDataY &y,
+                                    const int width, const Method method,
+                                    QVector<QPointF> &out)
+{
+  // Copy samples in full if there are few of them
+  const Samples samples(x, y);
+  const qsizetype budget = static_cast<qsizetype>(width) * POINTS_PER_PIXEL;
+  if (method == Disabled || width <= 0 || samples.count <= budget)
+  {
+    copy(samples, out);
+    return 1;
+  }
+
+  // Only decimate samples with monotonically increasing X values
+  if (!x.monotonic()) [[unlikely]]
+  {
+    copy(samples, out);
+    return 1;
+  }
+
+  // Decimate samples
+  if (method == LTTB)
+    lttb(samples, budget, out);
+  else
+    minMax(samples, y, width, out);
+
+  if (out.isEmpty())
+    return 1;
+
+  return static_cast<double>(samples.count) / out.count();
+}
+
+//------------------------------------------------------------------------------
+// Decimation algorithms
+//------------------------------------------------------------------------------
+
+/**
+ * @brief Copies every sample into @a out.
+ */
+void UI::PlotDecimation::copy(const Samples &samples, QVector<QPointF> &out)
+{
+  if (out.size() != samples.count)
+    out.resize(samples.count);
+
+  QPointF *dst = out.data();
+  for (qsizetype i = 0; i < samples.count; ++i)
+  {
+    dst[i].setX(samples.x(i));
+    dst[i].setY(samples.y(i));
+  }
+}
+
+/**
+ * @brief Keeps the first, minimum, maximum and last sample of every pixel
+ *        column, in their original order.
+ *
+ * Pixel columns are obtained by mapping the X range of the samples onto
+ * @a width columns, so irregularly spaced samples are handled correctly. The
+ * first sample of each column is found with a binary search over the X axis,
+ * and its extremes are read from the summary pyramid of the Y axis, so the
+ * cost depends on the plot width rather than on the number of samples.
+ */
+void UI::PlotDecimation::minMax(const Samples &samples, const PlotDataY &y,
+                                const int width, QVector<QPointF> &out)
+{
+  out.clear();
+  out.reserve(static_cast<qsizetype>(width) * POINTS_PER_PIXEL);
+
+  // Map the X range of the samples to pixel columns
+  const double x0 = samples.x(0);
+  const double x1 = samples.x(samples.count - 1);
+  const double scale = x1 > x0 ? width / (x1 - x0) : 0;
+
+  // Aggregate the samples of each column
+  qsizetype first = 0;
+  for (int column = 0; column < width && first < samples.count; ++column)
+  {
+    // Find the first sample of the next column
+    qsizetype end = samples.count;
+    if (column < width - 1 && scale > 0)
+    {
+      const double limit = x0 + (column + 1) / scale;
+      qsizetype lo = first;
+      while (lo < end)
+      {
+        const qsizetype mid = lo + (end - lo) / 2;
+        if (samples.x(mid) < limit)
+          lo = mid + 1;
+        else
+          end = mid;
+      }
+    }
+
+    // Skip empty columns
+    if (end == first)
+      continue;
+
+    // Emit the samples that represent the column
+    const auto s = y.summary(static_cast<std::size_t>(first),
+                             static_cast<std::size_t>(end - first));
+    qsizetype indexes[4] = {first, static_cast<qsizetype>(s.minIndex),
+                            static_cast<qsizetype>(s.maxIndex), end - 1};
+    std::sort(std::begin(indexes), std::end(indexes));
+    for (int k = 0; k < 4; ++k)
+    {
+      if (k > 0 && indexes[k] == indexes[k - 1])
+        continue;
+
+      out.append(QPointF(samples.x(indexes[k]), samples.y(indexes[k])));
+    }
+
+    first = end;
+  }
+}
+
+/**
+ * @brief Selects @a threshold samples with the Largest-Triangle-Three-Buckets
+ *        algorithm.
+ *
+ * The first and last samples are always kept. The remaining samples are split
+ * in equally sized buckets, and the sample of each bucket that forms the
+ * largest triangle with the previously selected sample and with the average
+ * of the next bucket is kept.
+ */
+void UI::PlotDecimation::lttb(const Samples &samples,
+                              const qsizetype threshold, QVector<QPointF> &out)
+{
+  out.clear();
+  out.reserve(threshold);
+
+  const qsizetype count = samples.count;
+  const double bucketSize = static_cast<double>(count - 2) / (threshold - 2);
+
+  qsizetype selected = 0;
+  out.append(QPointF(samples.x(0), samples.y(0)));
+  for (qsizetype b = 0; b < threshold - 2; ++b)
+  {
+    // Obtain the average of the next bucket
+    auto nextStart = static_cast<qsizetype>((b + 1) * bucketSize) + 1;
+    auto nextEnd = static_cast<qsizetype>((b + 2) * bucketSize) + 1;
+    nextEnd = qMin(nextEnd, count);
+    nextStart = qMin(nextStart, nextEnd - 1);
+
+    double avgX = 0;
+    double avgY = 0;
+    for (qsizetype i = nextStart; i < nextEnd; ++i)
+    {
+      avgX += samples.x(i);
+      avgY += samples.y(i);
+    }
+
+    const auto nextCount = static_cast<double>(nextEnd - nextStart);
+    avgX /= nextCount;
+    avgY /= nextCount;
+
+    // Select the sample of the current bucket with the largest triangle
+    const auto start = static_cast<qsizetype>(b * bucketSize) + 1;
+    const auto end = static_cast<qsizetype>((b + 1) * bucketSize) + 1;
+    const double ax = samples.x(selected);
+    const double ay = samples.y(selected);
+
+    double maxArea = -1;
+    qsizetype next = start;
+    for (qsizetype i = start; i < end; ++i)
+    {
+      const double area = std::abs((ax - avgX) * (samples.y(i) - ay)
+                                   - (ax - samples.x(i)) * (avgY - ay));
+      if (area > maxArea)
+      {
+        maxArea = area;
+        next = i;
+      }
+    }
+
+    selected = next;
+    out.append(QPointF(samples.x(selected), samples.y(selected)));
+  }
+
+  out.append(QPointF(samples.x(count - 1), samples.y(count - 1)));
+}
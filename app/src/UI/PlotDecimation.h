@@ -0,0 +1,77 @@
+/*
+ * Serial Studio
+ * https://serial-studio.com/
+ *
+ * Copyright (C) 2020–2025 Alex Spataru
+ *
+ * This file is dual-licensed:
+ *
+ * - Under the GNU GPLv3 (or later) for builds that exclude Pro modules.
+ * - Under the Serial Studio Commercial License for builds that include
+ *   any Pro functionality.
+ *
+ * You must comply with the terms of one of these licenses, depending
+ * on your use case.
+ *
+ * For GPL terms, see <https://www.gnu.org/licenses/gpl-3.0.html>
+ * For commercial terms, see LICENSE_COMMERCIAL.md in the project root.
+ *
+ * SPDX-License-Identifier: GPL-3.0-only OR LicenseRef-SerialStudio-Commercial
+ */
+
+#pragma once
+
+#include <QPointF>
+#include <QVector>
+#include <QStringList>
+
+#include "SerialStudio.h"
+
+namespace UI
+{
+/**
+ * @brief Reduces the number of points handed to plot series.
+ *
+ * Plots may retain many more samples than the number of horizontal pixels
+ * available to draw them, in which case most of the vertices sent to the
+ * graphics backend land on the same pixel column. The functions in this class
+ * copy the contents of the dashboard sample queues into a point vector,
+ * decimating them to at most POINTS_PER_PIXEL points per pixel column:
+ *
+ * - MinMax: keeps the first, minimum, maximum and last sample of every pixel
+ *   column (M4 aggregation). The resulting line is visually identical to the
+ *   full trace, spikes are never lost.
+ * - LTTB: Largest-Triangle-Three-Buckets, keeps the samples that best
+ *   preserve the visual shape of the trace, with a uniform point density.
+ *
+ * Decimation relies on monotonically increasing X values, plots that use a
+ * non-monotonic dataset for the X axis are always copied in full.
+ */
+class PlotDecimation
+{
+public:
+  enum Method
+  {
+    Disabled,
+    MinMax,
+    LTTB
+  };
+
+  static constexpr int POINTS_PER_PIXEL = 4;
+
+  [[nodiscard]] static QStringList availableMethods();
+
+  static double decimate(const PlotDataX &x, const PlotDataY &y,
+                         const int width, const Method method,
+                         QVector<QPointF> &out);
+
+private:
+  struct Samples;
+
+  static void copy(const Samples &samples, QVector<QPointF> &out);
+  static void minMax(const Samples &samples, const PlotDataY &y,
+                     const int width, QVector<QPointF> &out);
+  static void lttb(const Samples &samples, const qsizetype threshold,
+                   QVector<QPointF> &out);
+};
+} // namespace UI
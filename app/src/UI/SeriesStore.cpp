@@ -0,0 +1,268 @@
+/*
+ * Serial Studio
+ * https://serial-studio.com/
+ *
+ * Copyright (C) 2020–2025 Alex Spataru
+ *
+ * This file is dual-licensed:
+ *
+ * - Under the GNU GPLv3 (or later) for builds that exclude Pro modules.
+ * - Under the Serial Studio Commercial License for builds that include
+ *   any Pro functionality.
+ *
+ * You must comply with the terms of one of these licenses, depending
+ * on your use case.
+ *
+ * For GPL terms, see <https://www.gnu.org/licenses/gpl-3.0.html>
+ * For commercial terms, see LICENSE_COMMERCIAL.md in the project root.
+ *
+ * SPDX-License-Identifier: GPL-3.0-only OR LicenseRef-SerialStudio-Commercial
+ */
+
+#include "UI/SeriesStore.h"
+
+#include <algorithm>
+
+//------------------------------------------------------------------------------
+// Constructor & destructor
+//------------------------------------------------------------------------------
+
+/**
+ * @brief Constructs an empty store and starts its ingestion thread.
+ */
+UI::SeriesStore::SeriesStore()
+  : m_worker(new QObject())
+  , m_pending(false)
+  , m_capacity(1)
+  , m_generation(0)
+  , m_sequence(0)
+  , m_bufferGeneration{0, 0, 0}
+  , m_bufferSequence{0, 0, 0}
+{
+  m_worker->moveToThread(&m_workerThread);
+  QObject::connect(&m_workerThread, &QThread::finished, m_worker,
+                   &QObject::deleteLater);
+  m_workerThread.start();
+}
+
+/**
+ * @brief Stops the ingestion thread, pending commands are discarded.
+ */
+UI::SeriesStore::~SeriesStore()
+{
+  m_workerThread.quit();
+  m_workerThread.wait();
+}
+
+/**
+ * @brief Allocates a row ring for rows of @a columns values.
+ */
+UI::SeriesStore::RowRing::RowRing(const qsizetype columns)
+  : width(columns)
+  , values(static_cast<std::size_t>(columns * ROW_RING_CAPACITY), 0.0)
+{
+}
+
+//------------------------------------------------------------------------------
+// GUI thread functions
+//------------------------------------------------------------------------------
+
+/**
+ * @brief Replaces the channel layout of the store.
+ *
+ * All channels are cleared and zero-filled. The new layout reaches the front
+ * buffer once the ingestion thread has published it, see update(). Rows that
+ * were appended before this call and not consumed yet are discarded.
+ *
+ * @param indexes  Sorted, unique dataset IDs that require a channel.
+ * @param capacity Number of samples retained by each channel.
+ */
+void UI::SeriesStore::configure(const QVector<int> &indexes,
+                                const int capacity)
+{
+  Command command;
+  command.indexes = indexes;
+  command.capacity = std::max(1, capacity);
+  command.rows = std::make_shared<RowRing>(indexes.size());
+
+  m_rows = command.rows;
+  m_commands.enqueue(std::move(command));
+  schedule();
+}
+
+/**
+ * @brief Pushes one sample into every channel.
+ *
+ * The values are copied into the next free row of the row ring. If the
+ * ingestion thread fell ROW_RING_CAPACITY rows behind, the row is dropped.
+ *
+ * @param row Values to push, in the same order as the indexes given to
+ *            configure().
+ */
+void UI::SeriesStore::append(const QVector<double> &row)
+{
+  // Nothing to push into without a channel layout
+  if (!m_rows) [[unlikely]]
+    return;
+
+  // Drop the row if the ring is full
+  auto &ring = *m_rows;
+  const auto written = ring.written.load(std::memory_order_relaxed);
+  const auto pending = written - ring.consumed.load(std::memory_order_acquire);
+  if (pending >= static_cast<quint64>(ROW_RING_CAPACITY)) [[unlikely]]
+  {
+    schedule();
+    return;
+  }
+
+  // Copy the values into the free row & hand it to the ingestion thread
+  auto *slot = ring.values.data() + (written % ROW_RING_CAPACITY) * ring.width;
+  const auto count = std::min(ring.width, row.size());
+  std::copy_n(row.constData(), count, slot);
+  std::fill(slot + count, slot + ring.width, 0.0);
+  ring.written.store(written + 1, std::memory_order_release);
+  schedule();
+}
+
+/**
+ * @brief Takes the most recent buffer published by the ingestion thread.
+ *
+ * References obtained through front() must not be used after this function
+ * returns @c true.
+ *
+ * @return @c true if the front buffer changed, @c false otherwise.
+ */
+bool UI::SeriesStore::update()
+{
+  return m_buffers.update();
+}
+
+/**
+ * @brief Returns the buffer that is currently owned by the GUI thread.
+ */
+const UI::SeriesStore::Buffer &UI::SeriesStore::front() const
+{
+  return m_buffers.front();
+}
+
+/**
+ * @brief Wakes up the ingestion thread, unless it is already due to run.
+ */
+void UI::SeriesStore::schedule()
+{
+  if (!m_pending.exchange(true))
+    QMetaObject::invokeMethod(
+        m_worker, [this] { processCommands(); }, Qt::QueuedConnection);
+}
+
+//------------------------------------------------------------------------------
+// Ingestion thread functions
+//------------------------------------------------------------------------------
+
+/**
+ * @brief Applies pending layout changes and rows, and publishes the back
+ *        buffer.
+ */
+void UI::SeriesStore::processCommands()
+{
+  // Clear the flag first, so that rows appended from now on reschedule us
+  m_pending.store(false);
+
+  // Apply layout changes, rows of the previous ring are discarded
+  bool changed = false;
+  Command command;
+  while (m_commands.try_dequeue(command))
+  {
+    m_capacity = command.capacity;
+    m_indexes = std::move(command.indexes);
+    m_input = std::move(command.rows);
+    m_log.assign(static_cast<std::size_t>(m_capacity) * m_indexes.size(), 0.0);
+    m_sequence = 0;
+    ++m_generation;
+    changed = true;
+  }
+
+  // Move the new rows into the replay log
+  const auto sequence = m_sequence;
+  consumeRows();
+
+  // Bring the back buffer up to date & hand it to the GUI thread
+  if (changed || m_sequence != sequence)
+  {
+    sync(m_buffers.back(), m_buffers.backIndex());
+    m_buffers.publish();
+  }
+}
+
+/**
+ * @brief Copies the rows written by the GUI thread into the replay log.
+ *
+ * The log is a ring with room for one full channel worth of rows, so the
+ * newest row overwrites the oldest one once the log is full.
+ */
+void UI::SeriesStore::consumeRows()
+{
+  if (!m_input)
+    return;
+
+  auto &ring = *m_input;
+  const auto width = ring.width;
+  const auto written = ring.written.load(std::memory_order_acquire);
+  auto consumed = ring.consumed.load(std::memory_order_relaxed);
+  for (; consumed < written; ++consumed, ++m_sequence)
+  {
+    const auto *row
+        = ring.values.data() + (consumed % ROW_RING_CAPACITY) * width;
+    auto *entry = m_log.data() + (m_sequence % m_capacity) * width;
+    std::copy_n(row, width, entry);
+  }
+
+  ring.consumed.store(consumed, std::memory_order_release);
+}
+
+/**
+ * @brief Applies the rows that @a buffer has not received yet.
+ *
+ * Buffers with an outdated channel layout, or that missed rows that were
+ * already overwritten in the replay log, are zero-filled and rebuilt from the
+ * log. Since the log then holds a full channel worth of rows, the result is
+ * identical to pushing every row into the buffer.
+ *
+ * @param buffer Buffer owned by the ingestion thread.
+ * @param index  Position of @a buffer within the triple buffer.
+ */
+void UI::SeriesStore::sync(Buffer &buffer, const std::size_t index)
+{
+  // Rebuild the buffer if needed
+  const auto capacity = static_cast<quint64>(m_capacity);
+  const quint64 logStart = m_sequence - std::min(m_sequence, capacity);
+  if (m_bufferGeneration[index] != m_generation
+      || m_bufferSequence[index] < logStart)
+  {
+    buffer.channels.clear();
+    buffer.sampleAxis = PlotDataX(m_capacity);
+    buffer.sampleAxis.fillRange(0, 1);
+    for (const auto i : std::as_const(m_indexes))
+    {
+      auto &channel = buffer.channels[i];
+      channel = PlotDataY(m_capacity);
+      channel.fill(0);
+    }
+
+    m_bufferGeneration[index] = m_generation;
+    m_bufferSequence[index] = logStart;
+  }
+
+  // Replay the missing rows, channels are sorted just like the row values
+  const qsizetype width = m_indexes.size();
+  for (auto seq = m_bufferSequence[index]; seq < m_sequence; ++seq)
+  {
+    const auto *row = m_log.data() + (seq % capacity) * width;
+    auto channel = buffer.channels.begin();
+    for (qsizetype i = 0; i < width && channel != buffer.channels.end();
+         ++i, ++channel)
+      channel.value().push(row[i]);
+  }
+
+  m_bufferSequence[index] = m_sequence;
+}
@@ -0,0 +1,138 @@
+/*
+ * Serial Studio
+ * https://serial-studio.com/
+ *
+ * Copyright (C) 2020–2025 Alex Spataru
+ *
+ * This file is dual-licensed:
+ *
+ * - Under the GNU GPLv3 (or later) for builds that exclude Pro modules.
+ * - Under the Serial Studio Commercial License for builds that include
+ *   any Pro functionality.
+ *
+ * You must comply with the terms of one of these licenses, depending
+ * on your use case.
+ *
+ * For GPL terms, see <https://www.gnu.org/licenses/gpl-3.0.html>
+ * For commercial terms, see LICENSE_COMMERCIAL.md in the project root.
+ *
+ * SPDX-License-Identifier: GPL-3.0-only OR LicenseRef-SerialStudio-Commercial
+ */
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <memory>
+#include <vector>
+
+#include <QMap>
+#include <QThread>
+#include <QVector>
+
+#include "SerialStudio.h"
+#include "IO/TripleBuffer.h"
+#include "ThirdParty/readerwriterqueue.h"
+
+namespace UI
+{
+/**
+ * @brief Time-series store shared by the plot widgets of the dashboard.
+ *
+ * The store holds one sample queue (channel) per dataset, along with the
+ * sample index X-axis shared by all plots. Samples are pushed into the
+ * channels by a dedicated ingestion thread, so that updating the summary
+ * pyramids and sliding-window extremes of the channels does not run on the
+ * GUI thread.
+ *
+ * The GUI thread copies each row of values into a row ring that is allocated
+ * when the channel layout changes, and the ingestion thread consumes the ring
+ * through a pair of atomic counters, so appending a row never allocates.
+ *
+ * The channels are triple-buffered: the ingestion thread writes into a back
+ * buffer and publishes it with an atomic index swap, while the GUI thread
+ * takes the newest published buffer at each dashboard update. Plot widgets
+ * only read the front buffer, which is never written while it is in use.
+ *
+ * Since each buffer only receives the rows pushed after it was last
+ * published, the ingestion thread keeps the most recent rows in a replay log,
+ * a flat ring with room for one full channel worth of rows, which is replayed
+ * into a buffer when it is handed back to the writer.
+ */
+class SeriesStore
+{
+public:
+  /**
+   * @brief Channel data of one of the three buffers.
+   */
+  struct Buffer
+  {
+    PlotDataX sampleAxis;          ///< Sample index X-axis
+    QMap<int, PlotDataY> channels; ///< Channels by dataset unique ID
+  };
+
+  SeriesStore();
+  ~SeriesStore();
+
+  SeriesStore(const SeriesStore &) = delete;
+  SeriesStore &operator=(const SeriesStore &) = delete;
+
+  static constexpr qsizetype ROW_RING_CAPACITY = 1024;
+
+  void configure(const QVector<int> &indexes, const int capacity);
+  void append(const QVector<double> &row);
+
+  bool update();
+  [[nodiscard]] const Buffer &front() const;
+
+private:
+  /**
+   * @brief Single-producer/single-consumer ring of value rows.
+   *
+   * Written by the GUI thread and read by the ingestion thread. A new ring is
+   * created for every channel layout, so its width never changes.
+   */
+  struct RowRing
+  {
+    explicit RowRing(const qsizetype columns);
+
+    const qsizetype width;            ///< Values per row
+    std::vector<double> values;       ///< ROW_RING_CAPACITY rows of values
+    std::atomic<quint64> written{0};  ///< Rows written by the GUI thread
+    std::atomic<quint64> consumed{0}; ///< Rows read by the ingestion thread
+  };
+
+  /**
+   * @brief Layout change sent from the GUI thread to the ingestion thread.
+   */
+  struct Command
+  {
+    int capacity = 0;              ///< Samples per channel
+    QVector<int> indexes;          ///< Sorted dataset unique IDs
+    std::shared_ptr<RowRing> rows; ///< Row ring of the new layout
+  };
+
+  void schedule();
+  void consumeRows();
+  void processCommands();
+  void sync(Buffer &buffer, const std::size_t index);
+
+private:
+  QThread m_workerThread;
+  QObject *m_worker;
+  std::atomic<bool> m_pending;
+  std::shared_ptr<RowRing> m_rows;
+  moodycamel::ReaderWriterQueue<Command> m_commands{16};
+  IO::TripleBuffer<Buffer> m_buffers;
+
+  // State owned by the ingestion thread
+  int m_capacity;
+  QVector<int> m_indexes;
+  quint64 m_generation;
+  quint64 m_sequence;
+  std::vector<double> m_log;
+  std::shared_ptr<RowRing> m_input;
+  std::array<quint64, 3> m_bufferGeneration;
+  std::array<quint64, 3> m_bufferSequence;
+};
+} // namespace UI
@@ -82,9 +82,9 @@ void Widgets::Accelerometer::updateData()
   {
     auto dataset = acc.getDataset(i);
     if (dataset.widget() == QStringLiteral("x"))
-      x = dataset.value().toDouble();
+      x = dataset.numericValue();
     else if (dataset.widget() == QStringLiteral("y"))
-      y = dataset.value().toDouble();
+      y = dataset.numericValue();
   }
 
   // Calculate the radius (magnitude) using only X and Y
@@ -144,7 +144,7 @@ void Widgets::Bar::updateData()
   if (VALIDATE_WIDGET(SerialStudio::DashboardBar, m_index))
   {
     const auto &dataset = GET_DATASET(SerialStudio::DashboardBar, m_index);
-    auto value = qMax(m_minValue, qMin(m_maxValue, dataset.value().toDouble()));
+    auto value = qMax(m_minValue, qMin(m_maxValue, dataset.numericValue()));
     if (!qFuzzyCompare(value, m_value))
     {
       m_value = value;
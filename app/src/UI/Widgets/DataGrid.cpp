@@ -113,15 +113,14 @@ void Widgets::DataGrid::updateData()
   // Update values for every dataset in the group
   for (int i = 0; i < group.datasetCount(); ++i)
   {
-    // Obtain a reference to the dataset object & read its value
+    // Obtain a reference to the dataset object & format its value
     const auto &dataset = group.getDataset(i);
-    QString value = dataset.value();
-
-    // Convert the dataset to a number if needed
-    bool isNumber;
-    const double n = value.toDouble(&isNumber);
-    if (isNumber)
-      value = QString::number(n, 'f', UI::Dashboard::instance().precision());
+    QString value;
+    if (dataset.isNumeric())
+      value = QString::number(dataset.numericValue(), 'f',
+                              UI::Dashboard::instance().precision());
+    else
+      value = dataset.value();
 
     // Append dataset units (if available)
     if (!dataset.units().isEmpty())
@@ -107,7 +107,7 @@ void Widgets::Gauge::updateData()
   if (VALIDATE_WIDGET(SerialStudio::DashboardGauge, m_index))
   {
     const auto &dataset = GET_DATASET(SerialStudio::DashboardGauge, m_index);
-    auto value = qMax(m_minValue, qMin(m_maxValue, dataset.value().toDouble()));
+    auto value = qMax(m_minValue, qMin(m_maxValue, dataset.numericValue()));
     if (!qFuzzyCompare(value, m_value))
     {
       m_value = value;
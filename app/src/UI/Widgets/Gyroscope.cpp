@@ -147,7 +147,7 @@ void Widgets::Gyroscope::updateData()
     // Obtain dataset values & widget type
     const auto &dataset = gyro.getDataset(i);
     const auto &widget = dataset.widget();
-    const auto angle = dataset.value().toDouble();
+    const auto angle = dataset.numericValue();
 
     // Continously integrate the values
     if (m_integrateValues)
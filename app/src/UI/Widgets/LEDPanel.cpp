@@ -127,7 +127,7 @@ void Widgets::LEDPanel::updateData()
     {
       // Get the dataset and its values
       const auto &dataset = group.getDataset(i);
-      const auto value = dataset.value().toDouble();
+      const auto value = dataset.numericValue();
       const auto alarmValue = dataset.alarm();
 
       // Obtain the LED state
@@ -35,6 +35,8 @@ Widgets::MultiPlot::MultiPlot(const int index, QQuickItem *parent)
   , m_maxX(0)
   , m_minY(0)
   , m_maxY(0)
+  , m_pixelWidth(0)
+  , m_decimationRatio(1)
 {
   // Obtain group information
   if (VALIDATE_WIDGET(SerialStudio::DashboardMultiPlot, m_index))
@@ -182,6 +184,27 @@ const QList<bool> &Widgets::MultiPlot::visibleCurves() const
   return m_visibleCurves;
 }
 
+/**
+ * @brief Returns the width of the plot area in pixels.
+ * @return The width used to decimate the curves, 0 if unknown.
+ */
+int Widgets::MultiPlot::pixelWidth() const
+{
+  return m_pixelWidth;
+}
+
+/**
+ * @brief Returns the number of samples represented by each drawn point.
+ *
+ * The ratio is calculated over all visible curves.
+ *
+ * @return The decimation ratio, 1 if every sample is drawn.
+ */
+double Widgets::MultiPlot::decimationRatio() const
+{
+  return m_decimationRatio;
+}
+
 /**
  * @brief Draws the data on the given QLineSeries.
  * @param series The QXYSeries to draw the data on.
@@ -223,47 +246,31 @@ void Widgets::MultiPlot::updateData()
     const qsizetype plotCount = data.y.size();
     m_data.resize(plotCount);
 
-    // Get raw X pointer and state
-    const double *xData = X.raw();
-    std::size_t xIdx = X.frontIndex();
-    const std::size_t xCap = X.capacity();
-
-    // Populate data for each plot
+    // Copy the samples of each visible curve, decimated to the plot width
+    qsizetype samples = 0;
+    qsizetype points = 0;
+    const auto method = UI::Dashboard::instance().plotDecimation();
     for (qsizetype i = 0; i < plotCount; ++i)
     {
       // Skip if curve is not visible
       if (!m_visibleCurves[i])
         continue;
 
-      // Get raw pointer to dashboard data
-      const auto &Y = data.y[i];
-      const double *yData = Y.raw();
+      // Decimate curve data
+      const auto &Y = *data.y[i];
+      UI::PlotDecimation::decimate(X, Y, m_pixelWidth, method, m_data[i]);
 
-      // Get queue states for faster iteration
-      std::size_t yIdx = Y.frontIndex();
-      const std::size_t yCap = Y.capacity();
-
-      // Obtain the length of the shortest axis
-      const qsizetype count = std::min(X.size(), Y.size());
-
-      // Resize plot data if needed
-      QVector<QPointF> &outSeries = m_data[i];
-      if (outSeries.size() != count)
-        outSeries.resize(count);
-
-      // Keep local copies to avoid resetting each plot
-      std::size_t xi = xIdx;
-      std::size_t yi = yIdx;
+      // Keep track of the overall decimation ratio
+      samples += static_cast<qsizetype>(std::min(X.size(), Y.size()));
+      points += m_data[i].size();
+    }
 
-      // Update plot data points, avoid queue operations overhead
-      QPointF *dst = outSeries.data();
-      for (qsizetype j = 0; j < count; ++j)
-      {
-        dst[j].setX(xData[xi]);
-        dst[j].setY(yData[yi]);
-        xi = (xi + 1) % xCap;
-        yi = (yi + 1) % yCap;
-      }
+    // Update the decimation ratio
+    const double ratio = points > 0 ? double(samples) / points : 1;
+    if (!qFuzzyCompare(ratio, m_decimationRatio))
+    {
+      m_decimationRatio = ratio;
+      Q_EMIT decimationRatioChanged();
     }
 
     // Calculate auto scale range
@@ -271,6 +278,24 @@ void Widgets::MultiPlot::updateData()
   }
 }
 
+/**
+ * @brief Sets the width of the plot area in pixels.
+ *
+ * Curve data is decimated so that no more than a few points are drawn per
+ * pixel column, a width of 0 disables decimation.
+ *
+ * @param width The width of the plot area in pixels.
+ */
+void Widgets::MultiPlot::setPixelWidth(const int width)
+{
+  const auto w = qMax(0, width);
+  if (m_pixelWidth != w)
+  {
+    m_pixelWidth = w;
+    Q_EMIT pixelWidthChanged();
+  }
+}
+
 /**
  * @brief Updates the range of the multiplot.
  */
@@ -362,20 +387,19 @@ void Widgets::MultiPlot::calculateAutoScaleRange()
     m_minY = std::numeric_limits<double>::max();
     m_maxY = std::numeric_limits<double>::lowest();
 
-    // Loop through each dataset and find the min and max values
-    int index = 0;
-    for (const auto &curve : std::as_const(m_data))
+    // Obtain the extremes of each visible curve, these are tracked by the
+    // sample queues as they are updated, so no samples are scanned here
+    const auto &data = UI::Dashboard::instance().multiplotData(m_index);
+    const auto count = std::min<std::size_t>(data.y.size(),
+                                             m_visibleCurves.size());
+    for (std::size_t i = 0; i < count; ++i)
     {
-      if (m_visibleCurves[index])
+      const auto &curve = *data.y[i];
+      if (m_visibleCurves[i] && !curve.empty())
       {
-        for (auto i = 0; i < curve.count(); ++i)
-        {
-          m_minY = qMin(m_minY, curve[i].y());
-          m_maxY = qMax(m_maxY, curve[i].y());
-        }
+        m_minY = qMin(m_minY, curve.minimum());
+        m_maxY = qMax(m_maxY, curve.maximum());
       }
-
-      ++index;
     }
 
     // If the min and max are the same, set the range to 0-1
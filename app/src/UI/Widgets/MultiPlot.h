@@ -44,11 +44,17 @@ class MultiPlot : public QQuickItem
   Q_PROPERTY(double xTickInterval READ xTickInterval NOTIFY rangeChanged)
   Q_PROPERTY(double yTickInterval READ yTickInterval NOTIFY rangeChanged)
   Q_PROPERTY(QList<bool> visibleCurves READ visibleCurves NOTIFY curvesChanged)
+  // clang-format off
+  Q_PROPERTY(int pixelWidth READ pixelWidth WRITE setPixelWidth NOTIFY pixelWidthChanged)
+  Q_PROPERTY(double decimationRatio READ decimationRatio NOTIFY decimationRatioChanged)
+  // clang-format on
 
 signals:
   void rangeChanged();
   void themeChanged();
   void curvesChanged();
+  void pixelWidthChanged();
+  void decimationRatioChanged();
 
 public:
   explicit MultiPlot(const int index = -1, QQuickItem *parent = nullptr);
@@ -75,9 +81,12 @@ public:
   [[nodiscard]] const QStringList &colors() const;
   [[nodiscard]] const QStringList &labels() const;
   [[nodiscard]] const QList<bool> &visibleCurves() const;
+  [[nodiscard]] int pixelWidth() const;
+  [[nodiscard]] double decimationRatio() const;
 
 public slots:
   void draw(QXYSeries *series, const int index);
+  void setPixelWidth(const int width);
 
   void updateData();
   void updateRange();
@@ -93,6 +102,8 @@ private:
   double m_maxX;
   double m_minY;
   double m_maxY;
+  int m_pixelWidth;
+  double m_decimationRatio;
   QString m_yLabel;
   QStringList m_colors;
   QStringList m_labels;
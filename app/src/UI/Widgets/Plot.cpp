@@ -34,6 +34,8 @@ Widgets::Plot::Plot(const int index, QQuickItem *parent)
   , m_maxX(0)
   , m_minY(0)
   , m_maxY(0)
+  , m_pixelWidth(0)
+  , m_decimationRatio(1)
 {
   if (VALIDATE_WIDGET(SerialStudio::DashboardPlot, m_index))
   {
@@ -138,6 +140,24 @@ const QString &Widgets::Plot::xLabel() const
   return m_xLabel;
 }
 
+/**
+ * @brief Returns the width of the plot area in pixels.
+ * @return The width used to decimate the plot data, 0 if unknown.
+ */
+int Widgets::Plot::pixelWidth() const
+{
+  return m_pixelWidth;
+}
+
+/**
+ * @brief Returns the number of samples represented by each drawn point.
+ * @return The decimation ratio, 1 if every sample is drawn.
+ */
+double Widgets::Plot::decimationRatio() const
+{
+  return m_decimationRatio;
+}
+
 /**
  * @brief Draws the data on the given QLineSeries.
  * @param series The QLineSeries to draw the data on.
@@ -166,35 +186,41 @@ void Widgets::Plot::updateData()
   if (VALIDATE_WIDGET(SerialStudio::DashboardPlot, m_index))
   {
     // Get plotting data
-    const auto &plotData = UI::Dashboard::instance().plotData(m_index);
-    const auto &X = *plotData.x;
-    const auto &Y = *plotData.y;
-
-    // Resize series array if needed
-    const qsizetype count = std::min(X.size(), Y.size());
-    if (m_data.size() != count)
-      m_data.resize(count);
-
-    // Obtain raw pointers
-    QPointF *out = m_data.data();
-    const auto *xData = X.raw();
-    const auto *yData = Y.raw();
-
-    // Get queue states for faster iteration
-    std::size_t xIdx = X.frontIndex();
-    std::size_t yIdx = Y.frontIndex();
-
-    // Update plot data points, avoid queue operations overhead
-    for (qsizetype i = 0; i < count; ++i)
+    const auto &dashboard = UI::Dashboard::instance();
+    const auto &plotData = dashboard.plotData(m_index);
+
+    // Copy the samples, decimated to the width of the plot
+    const auto ratio = UI::PlotDecimation::decimate(
+        *plotData.x, *plotData.y, m_pixelWidth, dashboard.plotDecimation(),
+        m_data);
+
+    // Update the decimation ratio
+    if (!qFuzzyCompare(ratio, m_decimationRatio))
     {
-      out[i].setX(xData[xIdx]);
-      out[i].setY(yData[yIdx]);
-      xIdx = (xIdx + 1) % X.capacity();
-      yIdx = (yIdx + 1) % Y.capacity();
+      m_decimationRatio = ratio;
+      Q_EMIT decimationRatioChanged();
     }
   }
 }
 
+/**
+ * @brief Sets the width of the plot area in pixels.
+ *
+ * Plot data is decimated so that no more than a few points are drawn per pixel
+ * column, a width of 0 disables decimation.
+ *
+ * @param width The width of the plot area in pixels.
+ */
+void Widgets::Plot::setPixelWidth(const int width)
+{
+  const auto w = qMax(0, width);
+  if (m_pixelWidth != w)
+  {
+    m_pixelWidth = w;
+    Q_EMIT pixelWidthChanged();
+  }
+}
+
 /**
  * @brief Updates the range of the X-axis values.
  */
@@ -250,9 +276,9 @@ void Widgets::Plot::calculateAutoScaleRange()
   bool yChanged = false;
 
   // Obtain scale range for Y-axis
+  const auto &plotData = UI::Dashboard::instance().plotData(m_index);
   const auto &dy = GET_DATASET(SerialStudio::DashboardPlot, m_index);
-  yChanged = computeMinMaxValues(m_minY, m_maxY, dy, true,
-                                 [](const QPointF &p) { return p.y(); });
+  yChanged = computeMinMaxValues(m_minY, m_maxY, dy, *plotData.y, true);
 
   // Obtain range scale for X-axis
   if (SerialStudio::activated())
@@ -260,8 +286,7 @@ void Widgets::Plot::calculateAutoScaleRange()
     if (UI::Dashboard::instance().datasets().contains(dy.xAxisId()))
     {
       const auto &dx = UI::Dashboard::instance().datasets()[dy.xAxisId()];
-      xChanged = computeMinMaxValues(m_minX, m_maxX, dx, false,
-                                     [](const QPointF &p) { return p.x(); });
+      xChanged = computeMinMaxValues(m_minX, m_maxX, dx, *plotData.x, false);
     }
   }
 
@@ -286,19 +311,17 @@ void Widgets::Plot::calculateAutoScaleRange()
 /**
  * @brief Computes the minimum and maximum values for a given axis of the plot.
  *
- * This templated function calculates the minimum and maximum values for a plot
- * axis (either X or Y) using the provided dataset and an extractor function. If
- * the dataset has no valid range or is empty, a fallback range `[0, 1]` or an
- * adjusted range is applied.
- *
- * @tparam Extractor A callable object (e.g., lambda) used to extract values
- *                   from data points.
+ * This function calculates the minimum and maximum values for a plot axis
+ * (either X or Y) using the provided dataset. If the dataset has no valid
+ * range, the extremes of the axis samples are used, these are tracked by the
+ * sample queue as it is updated, so no samples are scanned here. If there are
+ * no samples, a fallback range `[0, 1]` is applied.
  *
  * @param min Reference to the variable storing the minimum value.
  * @param max Reference to the variable storing the maximum value.
  * @param dataset The dataset to compute the range from.
- * @param extractor A function used to extract axis-specific values (e.g.,
- *                  `p.y()` or `p.x()`).
+ * @param values The samples of the axis.
+ * @param addPadding Whether to add a 10% padding to the computed range.
  *
  * @return `true` if the computed range differs from the previous range, `false`
  * otherwise.
@@ -306,11 +329,10 @@ void Widgets::Plot::calculateAutoScaleRange()
  * @note If the dataset has the same minimum and maximum values, the range is
  * adjusted to provide a better display.
  */
-template<typename Extractor>
 bool Widgets::Plot::computeMinMaxValues(double &min, double &max,
                                         const JSON::Dataset &dataset,
-                                        const bool addPadding,
-                                        Extractor extractor)
+                                        const IO::SummaryQueue &values,
+                                        const bool addPadding)
 {
   // Store previous values
   bool ok = true;
@@ -318,7 +340,7 @@ bool Widgets::Plot::computeMinMaxValues(double &min, double &max,
   const auto prevMaxY = max;
 
   // If the data is empty, set the range to 0-1
-  if (m_data.isEmpty())
+  if (values.empty())
   {
     min = 0;
     max = 1;
@@ -339,15 +361,8 @@ bool Widgets::Plot::computeMinMaxValues(double &min, double &max,
   if (!ok)
   {
     // Get minimum and maximum values from data
-    min = std::numeric_limits<double>::max();
-    max = std::numeric_limits<double>::lowest();
-
-    // Loop through the plot data and update the min and max
-    for (auto i = 0; i < m_data.size(); ++i)
-    {
-      min = qMin(min, extractor(m_data[i]));
-      max = qMax(max, extractor(m_data[i]));
-    }
+    min = values.minimum();
+    max = values.maximum();
 
     // If min and max are the same, adjust the range
     if (qFuzzyCompare(min, max))
@@ -26,6 +26,7 @@
 #include <QQuickItem>
 
 #include "JSON/Dataset.h"
+#include "IO/SummaryQueue.h"
 
 namespace Widgets
 {
@@ -43,9 +44,15 @@ class Plot : public QQuickItem
   Q_PROPERTY(double maxY READ maxY NOTIFY rangeChanged)
   Q_PROPERTY(double xTickInterval READ xTickInterval NOTIFY rangeChanged)
   Q_PROPERTY(double yTickInterval READ yTickInterval NOTIFY rangeChanged)
+  // clang-format off
+  Q_PROPERTY(int pixelWidth READ pixelWidth WRITE setPixelWidth NOTIFY pixelWidthChanged)
+  Q_PROPERTY(double decimationRatio READ decimationRatio NOTIFY decimationRatioChanged)
+  // clang-format on
 
 signals:
   void rangeChanged();
+  void pixelWidthChanged();
+  void decimationRatioChanged();
 
 public:
   explicit Plot(const int index = -1, QQuickItem *parent = nullptr);
@@ -63,9 +70,12 @@ public:
   [[nodiscard]] double yTickInterval() const;
   [[nodiscard]] const QString &yLabel() const;
   [[nodiscard]] const QString &xLabel() const;
+  [[nodiscard]] int pixelWidth() const;
+  [[nodiscard]] double decimationRatio() const;
 
 public slots:
   void draw(QXYSeries *series);
+  void setPixelWidth(const int width);
 
 private slots:
   void updateData();
@@ -73,10 +83,10 @@ private slots:
   void calculateAutoScaleRange();
 
 private:
-  template<typename Extractor>
   bool computeMinMaxValues(double &min, double &max,
-                           const JSON::Dataset &dataset, const bool addPadding,
-                           Extractor extractor);
+                           const JSON::Dataset &dataset,
+                           const IO::SummaryQueue &values,
+                           const bool addPadding);
 
 private:
   int m_index;
@@ -84,6 +94,8 @@ private:
   double m_maxX;
   double m_minY;
   double m_maxY;
+  int m_pixelWidth;
+  double m_decimationRatio;
   QString m_yLabel;
   QString m_xLabel;
   QVector<QPointF> m_data;